@@ -0,0 +1,233 @@
+#pragma once
+#include "Vector2.h"
+#include "Matrix3.h"
+#include "dllmain.h"
+#include "simd.h"
+
+/*
+* Affine2T
+* template class
+* 2D affine transformation, a 2x2 linear part (rotation and scale) plus a translation
+* stored in the same column order as a Matrix3T with the constant (0, 0, 1) row left out,
+* so composing and applying it skips all of the multiplications by 0 and 1
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+TEMPLATE
+class Affine2T
+{
+public:
+
+	Vector2T<T> mat[3]; //x axis, y axis and translation
+
+	/*
+	* Affine2T()
+	* default constructor
+	* starts as the identity transformation
+	*/
+	MATHSLIBRARY_API Affine2T();
+
+	/*
+	* Affine2T()
+	* argument constructor
+	*
+	* @param Vector2T<T> xAxis - the 1st column of the linear part
+	* @param Vector2T<T> yAxis - the 2nd column of the linear part
+	* @param Vector2T<T> translation - the translation
+	*/
+	MATHSLIBRARY_API Affine2T(Vector2T<T> xAxis, Vector2T<T> yAxis, Vector2T<T> translation);
+
+	/*
+	* Affine2T()
+	* conversion constructor
+	* takes the top two rows of a 2D homogeneous transformation matrix
+	*
+	* @param const Matrix3T<T>& matrix - the matrix to convert
+	*/
+	MATHSLIBRARY_API Affine2T(const Matrix3T<T>& matrix);
+
+	/*
+	* Affine2T()
+	* default destructor
+	*/
+	MATHSLIBRARY_API ~Affine2T() {};
+
+	/*
+	* operator[]
+	* subscript overload
+	*
+	* @param const int - the column to access
+	* @returns Vector2T& - the column accessed
+	*/
+	MATHSLIBRARY_API Vector2T<T>& operator[](const int index);
+
+	/*
+	* operator Matrix3T<T>
+	* cast to Matrix3T<T> overload, used when handing the transform to the renderer
+	*
+	* @returns Matrix3T<T> - the transformation as a homogeneous 3x3 matrix
+	*/
+	MATHSLIBRARY_API operator Matrix3T<T>();
+
+	/*
+	* operator*
+	* composes two transformations, the other transformation is applied first
+	* gives the same result as multiplying the equivalent Matrix3Ts
+	*
+	* @param const Affine2T& - the other transformation to use
+	* @returns Affine2T - the combined transformation
+	*/
+	MATHSLIBRARY_API Affine2T<T> operator*(const Affine2T<T>& other);
+
+	/*
+	* operator==
+	* tests if two transformations are exactly the same, element by element
+	*
+	* @param const Affine2T& - the other transformation to compare with
+	* @returns bool - true if every element matches
+	*/
+	MATHSLIBRARY_API bool operator==(const Affine2T<T>& other);
+
+	/*
+	* operator!=
+	* tests if two transformations differ in any element
+	*
+	* @param const Affine2T& - the other transformation to compare with
+	* @returns bool - true if any element differs
+	*/
+	MATHSLIBRARY_API bool operator!=(const Affine2T<T>& other);
+
+	/*
+	* identity
+	* resets to a transformation that does nothing
+	*
+	* @returns void
+	*/
+	MATHSLIBRARY_API void identity();
+
+	/*
+	* setTRS
+	* generates translation * rotation * scale directly,
+	* only one sin and cos are evaluated and no matrices are multiplied
+	*
+	* @param Vector2T<T> translation - the translation to apply last
+	* @param T radians - the rotation to apply after scaling
+	* @param Vector2T<T> scale - the scale to apply first
+	* @returns void
+	*/
+	MATHSLIBRARY_API void setTRS(Vector2T<T> translation, T radians, Vector2T<T> scale);
+
+	/*
+	* transformPoint
+	* applies the full transformation to a position
+	*
+	* @param Vector2T<T> point - the position to transform
+	* @returns Vector2T<T> - the transformed position
+	*/
+	MATHSLIBRARY_API Vector2T<T> transformPoint(Vector2T<T> point);
+
+	/*
+	* transformVector
+	* applies only the rotation and scale to a direction or offset
+	*
+	* @param Vector2T<T> vector - the direction to transform
+	* @returns Vector2T<T> - the transformed direction
+	*/
+	MATHSLIBRARY_API Vector2T<T> transformVector(Vector2T<T> vector);
+
+	/*
+	* transformPoints
+	* applies the full transformation to a whole array of positions at once
+	* the destination may be the same array as points
+	*
+	* @param const Vector2T<T>* points - the positions to transform
+	* @param Vector2T<T>* destination - the buffer to write the transformed positions to, at least count long
+	* @param size_t count - the number of positions
+	* @returns void
+	*/
+	MATHSLIBRARY_API void transformPoints(const Vector2T<T>* points, Vector2T<T>* destination, size_t count);
+
+	/*
+	* transformPoints
+	* structure-of-arrays version, the x and y components live in separate arrays
+	* the destination arrays may be the same as the source arrays
+	*
+	* @param const T* xs - the x components of the positions
+	* @param const T* ys - the y components of the positions
+	* @param T* destinationXs - the buffer to write the transformed x components to
+	* @param T* destinationYs - the buffer to write the transformed y components to
+	* @param size_t count - the number of positions
+	* @returns void
+	*/
+	MATHSLIBRARY_API void transformPoints(const T* xs, const T* ys, T* destinationXs, T* destinationYs, size_t count);
+
+	/*
+	* transformVectors
+	* applies only the rotation and scale to a whole array of directions at once
+	* the destination may be the same array as vectors
+	*
+	* @param const Vector2T<T>* vectors - the directions to transform
+	* @param Vector2T<T>* destination - the buffer to write the transformed directions to, at least count long
+	* @param size_t count - the number of directions
+	* @returns void
+	*/
+	MATHSLIBRARY_API void transformVectors(const Vector2T<T>* vectors, Vector2T<T>* destination, size_t count);
+
+	/*
+	* determinant
+	* calcualates the determinant of the linear part
+	*
+	* @returns T - the determinant of the transformation
+	*/
+	MATHSLIBRARY_API T determinant();
+
+	/*
+	* invert
+	* inverts the transformation in closed form
+	* sometimes transformations aren't invertible (eg. a scale of 0)
+	*
+	* @returns bool - indicating if the inversion worked or not
+	*/
+	MATHSLIBRARY_API bool invert();
+
+	/*
+	* getTranslation
+	*
+	* gets the translation of the transformation
+	*
+	* @returns Vector2T<T> - the translation
+	*/
+	MATHSLIBRARY_API Vector2T<T> getTranslation();
+
+	/*
+	* getScale
+	*
+	* gets the scale along each axis, decomposed the same way as Matrix3T::getScale
+	*
+	* @returns Vector2T<T> - the scale along each axis
+	*/
+	MATHSLIBRARY_API Vector2T<T> getScale();
+
+	/*
+	* getRotation
+	*
+	* gets the rotation, decomposed the same way as Matrix3T::getRotation
+	*
+	* @returns T - the rotation in radians
+	*/
+	MATHSLIBRARY_API T getRotation();
+};
+
+using Affine2 = Affine2T<float>;
+
+#ifdef MATHSLIBRARY_SIMD
+//SSE versions of the float instantiation, defined in Affine2.inl
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Affine2T<float>::transformPoints(const Vector2T<float>* points, Vector2T<float>* destination, size_t count);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Affine2T<float>::transformPoints(const float* xs, const float* ys, float* destinationXs, float* destinationYs, size_t count);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Affine2T<float>::transformVectors(const Vector2T<float>* vectors, Vector2T<float>* destination, size_t count);
+#endif
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Affine2.inl"
+#endif
@@ -0,0 +1,266 @@
+#pragma once
+#include "Affine2.h"
+
+//default constructor
+TEMPLATE
+Affine2T<T>::Affine2T()
+{
+	identity();
+}
+
+//argument constructor
+TEMPLATE
+Affine2T<T>::Affine2T(Vector2T<T> xAxis, Vector2T<T> yAxis, Vector2T<T> translation)
+{
+	mat[0] = xAxis;
+	mat[1] = yAxis;
+	mat[2] = translation;
+}
+
+//conversion constructor
+TEMPLATE
+Affine2T<T>::Affine2T(const Matrix3T<T>& matrix)
+{
+	//the bottom row of a 2D transformation is always (0, 0, 1), drop it
+	for (int i = 0; i < 3; i++)
+	{
+		mat[i] = Vector2T<T>{ matrix.mat[i].x, matrix.mat[i].y };
+	}
+}
+
+//subscript operator
+TEMPLATE
+Vector2T<T>& Affine2T<T>::operator[](const int index)
+{
+	return mat[index];
+}
+
+//cast to matrix3
+TEMPLATE
+Affine2T<T>::operator Matrix3T<T>()
+{
+	return Matrix3T<T>{ mat[0].x, mat[0].y, 0,
+						mat[1].x, mat[1].y, 0,
+						mat[2].x, mat[2].y, 1 };
+}
+
+//composition operator
+TEMPLATE
+Affine2T<T> Affine2T<T>::operator*(const Affine2T<T>& other)
+{
+	Affine2T<T> product;
+
+	//the linear parts multiply as 2x2 matrices
+	for (int i = 0; i < 2; i++)
+	{
+		product.mat[i].x = mat[0].x * other.mat[i].x + mat[1].x * other.mat[i].y;
+		product.mat[i].y = mat[0].y * other.mat[i].x + mat[1].y * other.mat[i].y;
+	}
+
+	//the other translation gets transformed by this one
+	product.mat[2].x = mat[0].x * other.mat[2].x + mat[1].x * other.mat[2].y + mat[2].x;
+	product.mat[2].y = mat[0].y * other.mat[2].x + mat[1].y * other.mat[2].y + mat[2].y;
+
+	return product;
+}
+
+//equality operator
+TEMPLATE
+bool Affine2T<T>::operator==(const Affine2T<T>& other)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		if (mat[i].x != other.mat[i].x || mat[i].y != other.mat[i].y)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//inequality operator
+TEMPLATE
+bool Affine2T<T>::operator!=(const Affine2T<T>& other)
+{
+	return !(*this == other);
+}
+
+//convert to identity
+TEMPLATE
+void Affine2T<T>::identity()
+{
+	mat[0] = Vector2T<T>{ 1, 0 };
+	mat[1] = Vector2T<T>{ 0, 1 };
+	mat[2] = Vector2T<T>{ 0, 0 };
+}
+
+//translation * rotation * scale in one step
+TEMPLATE
+void Affine2T<T>::setTRS(Vector2T<T> translation, T radians, Vector2T<T> scale)
+{
+	T c = (T)cos(radians);
+	T s = (T)sin(radians);
+
+	//same layout as Matrix3T::setRotateZ with the scale folded into each axis
+	mat[0] = Vector2T<T>{ c * scale.x, s * scale.x };
+	mat[1] = Vector2T<T>{ -s * scale.y, c * scale.y };
+	mat[2] = translation;
+}
+
+//transform a position
+TEMPLATE
+Vector2T<T> Affine2T<T>::transformPoint(Vector2T<T> point)
+{
+	return Vector2T<T>{ mat[0].x * point.x + mat[1].x * point.y + mat[2].x,
+						mat[0].y * point.x + mat[1].y * point.y + mat[2].y };
+}
+
+//transform a direction
+TEMPLATE
+Vector2T<T> Affine2T<T>::transformVector(Vector2T<T> vector)
+{
+	return Vector2T<T>{ mat[0].x * vector.x + mat[1].x * vector.y,
+						mat[0].y * vector.x + mat[1].y * vector.y };
+}
+
+//transform an array of positions
+TEMPLATE
+void Affine2T<T>::transformPoints(const Vector2T<T>* points, Vector2T<T>* destination, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		T x = points[i].x;
+		T y = points[i].y;
+
+		destination[i].x = mat[0].x * x + mat[1].x * y + mat[2].x;
+		destination[i].y = mat[0].y * x + mat[1].y * y + mat[2].y;
+	}
+}
+
+//transform an array of positions (structure of arrays)
+TEMPLATE
+void Affine2T<T>::transformPoints(const T* xs, const T* ys, T* destinationXs, T* destinationYs, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		T x = xs[i];
+		T y = ys[i];
+
+		destinationXs[i] = mat[0].x * x + mat[1].x * y + mat[2].x;
+		destinationYs[i] = mat[0].y * x + mat[1].y * y + mat[2].y;
+	}
+}
+
+//transform an array of directions
+TEMPLATE
+void Affine2T<T>::transformVectors(const Vector2T<T>* vectors, Vector2T<T>* destination, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		T x = vectors[i].x;
+		T y = vectors[i].y;
+
+		destination[i].x = mat[0].x * x + mat[1].x * y;
+		destination[i].y = mat[0].y * x + mat[1].y * y;
+	}
+}
+
+//determinant of the linear part
+TEMPLATE
+T Affine2T<T>::determinant()
+{
+	return mat[0].x * mat[1].y - mat[1].x * mat[0].y;
+}
+
+//invert the transformation
+TEMPLATE
+bool Affine2T<T>::invert()
+{
+	T det = determinant();
+
+	//if the determinant is 0, the inversion wont work
+	if (det == 0)
+	{
+		return false;
+	}
+
+	T invDet = 1 / det;
+
+	//inverse of the 2x2 linear part
+	Vector2T<T> xAxis = Vector2T<T>{ mat[1].y * invDet, -mat[0].y * invDet };
+	Vector2T<T> yAxis = Vector2T<T>{ -mat[1].x * invDet, mat[0].x * invDet };
+
+	//the translation has to be undone after the linear part is
+	Vector2T<T> translation = mat[2];
+
+	mat[0] = xAxis;
+	mat[1] = yAxis;
+	mat[2] = Vector2T<T>{ -(xAxis.x * translation.x + yAxis.x * translation.y),
+						-(xAxis.y * translation.x + yAxis.y * translation.y) };
+
+	return true;
+}
+
+//get the translation
+TEMPLATE
+Vector2T<T> Affine2T<T>::getTranslation()
+{
+	return mat[2];
+}
+
+//get the scale
+TEMPLATE
+Vector2T<T> Affine2T<T>::getScale()
+{
+	//get the sign of the scale x
+	T signX = mat[0].x > 0 ? (T)1 : (T)-1;
+	signX = mat[0].x == 0 ? (T)0 : signX;
+
+	//get the sign of the scale y
+	T signY = mat[1].y > 0 ? (T)1 : (T)-1;
+	signY = mat[1].y == 0 ? (T)0 : signY;
+
+	//scale decomposition
+	T sX = signX * (T)sqrt(mat[0].x * mat[0].x + mat[0].y * mat[0].y);
+	T sY = signY * (T)sqrt(mat[1].x * mat[1].x + mat[1].y * mat[1].y);
+
+	return Vector2T<T>{sX, sY};
+}
+
+//get the rotation
+TEMPLATE
+T Affine2T<T>::getRotation()
+{
+	return (T)atan2(-mat[0].y, mat[0].x);
+}
+
+
+#ifdef MATHSLIBRARY_SIMD
+//transform an array of positions (SSE)
+template<>
+MATHSLIBRARY_INLINE void Affine2T<float>::transformPoints(const Vector2T<float>* points, Vector2T<float>* destination, size_t count)
+{
+	simdTransform2(_mm_setr_ps(mat[0].x, mat[0].y, mat[0].x, mat[0].y),
+				   _mm_setr_ps(mat[1].x, mat[1].y, mat[1].x, mat[1].y),
+				   _mm_setr_ps(mat[2].x, mat[2].y, mat[2].x, mat[2].y),
+				   &points->x, &destination->x, count);
+}
+
+//transform an array of positions, structure of arrays (SSE)
+template<>
+MATHSLIBRARY_INLINE void Affine2T<float>::transformPoints(const float* xs, const float* ys, float* destinationXs, float* destinationYs, size_t count)
+{
+	simdTransform2SoA(&mat[0].x, xs, ys, destinationXs, destinationYs, count);
+}
+
+//transform an array of directions (SSE)
+template<>
+MATHSLIBRARY_INLINE void Affine2T<float>::transformVectors(const Vector2T<float>* vectors, Vector2T<float>* destination, size_t count)
+{
+	simdTransform2(_mm_setr_ps(mat[0].x, mat[0].y, mat[0].x, mat[0].y),
+				   _mm_setr_ps(mat[1].x, mat[1].y, mat[1].x, mat[1].y),
+				   _mm_setzero_ps(),
+				   &vectors->x, &destination->x, count);
+}
+#endif
@@ -121,4 +121,9 @@ public:
 
 };
 
-using Matrix2 = Matrix2T<float>;
\ No newline at end of file
+using Matrix2 = Matrix2T<float>;
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Matrix2.inl"
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector3.h"
 #include "dllmain.h"
+#include "simd.h"
 
 /*
 * Matrix3T
@@ -70,10 +71,10 @@ public:
 	* operator*
 	* applys matrix multiplication to two Matrix3Ts
 	*
-	* @param const Matrix3T - the other matrix to use
+	* @param const Matrix3T& - the other matrix to use
 	* @returns Matrix3T - the product of the matrices
 	*/
-	MATHSLIBRARY_API Matrix3T<T> operator*(const Matrix3T<T> other);
+	MATHSLIBRARY_API Matrix3T<T> operator*(const Matrix3T<T>& other);
 
 	/*
 	* identity
@@ -301,6 +302,31 @@ public:
 	* @returns void
 	*/
 	MATHSLIBRARY_API void lookAt(Vector3T<T> direction, Vector3T<T> up);
+
+	/*
+	* transformPoints
+	*
+	* treats the matrix as a 2D homogeneous transformation and applies it
+	* to a whole array of positions at once, the same as (Vector3(x, y, 1) * matrix).GetXY()
+	* for every point. the destination may be the same array as points
+	*
+	* @param const Vector2T<T>* points - the positions to transform
+	* @param Vector2T<T>* destination - the buffer to write the transformed positions to, at least count long
+	* @param size_t count - the number of positions
+	* @returns void
+	*/
+	MATHSLIBRARY_API void transformPoints(const Vector2T<T>* points, Vector2T<T>* destination, size_t count);
 };
 
-using Matrix3 = Matrix3T<float>;
\ No newline at end of file
+using Matrix3 = Matrix3T<float>;
+
+#ifdef MATHSLIBRARY_SIMD
+//SSE versions of the float instantiation, defined in Matrix3.inl
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Matrix3T<float> Matrix3T<float>::operator*(const Matrix3T<float>& other);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Matrix3T<float>::transformPoints(const Vector2T<float>* points, Vector2T<float>* destination, size_t count);
+#endif
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Matrix3.inl"
+#endif
\ No newline at end of file
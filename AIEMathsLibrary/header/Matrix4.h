@@ -1,6 +1,7 @@
 #pragma once
 #include "Vector4.h"
 #include "dllmain.h"
+#include "simd.h"
 
 /*
 * Matrix4T
@@ -78,10 +79,10 @@ public:
 	* operator*
 	* applys matrix multiplication to two Matrix4Ts
 	*
-	* @param const Matrix4T - the other matrix to use
+	* @param const Matrix4T& - the other matrix to use
 	* @returns Matrix4T - the product of the matrices
 	*/
-	MATHSLIBRARY_API Matrix4T<T> operator*(const Matrix4T<T> other);
+	MATHSLIBRARY_API Matrix4T<T> operator*(const Matrix4T<T>& other);
 
 	/*
 	* identity
@@ -142,8 +143,8 @@ public:
 	* determinant
 	* calcualates the determinant of the matrix
 	*
-	* this process is massive for a 4x4 matrix, so
-	* the calculation is broken down into 4 3x3 matrix determinants
+	* this process is massive for a 4x4 matrix, so the calculation
+	* is broken down into the twelve 2x2 determinants of the top and bottom rows
 	*
 	* @returns T - the determinant of the matrix
 	*/
@@ -323,4 +324,18 @@ public:
 
 };
 
-using Matrix4 = Matrix4T<float>;
\ No newline at end of file
+using Matrix4 = Matrix4T<float>;
+
+#ifdef MATHSLIBRARY_SIMD
+//SSE versions of the float instantiation, defined in Matrix4.inl
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Matrix4T<float> Matrix4T<float>::operator*(const Matrix4T<float>& other);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Matrix4T<float>::transpose();
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE float Matrix4T<float>::determinant();
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE bool Matrix4T<float>::invert();
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Vector4T<float> Vector4T<float>::operator*(const Matrix4T<float>& matrix);
+#endif
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Matrix4.inl"
+#endif
\ No newline at end of file
@@ -0,0 +1,669 @@
+#pragma once
+#include "Matrix4.h"
+#include "Vector3.h" //scale and translation helpers take vector3s
+
+TEMPLATE
+//default constructor
+Matrix4T<T>::Matrix4T()
+{
+	//create an empty matrix
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			mat[i][j] = 0.0f;
+		}
+	}
+}
+
+//argument constructor
+TEMPLATE
+Matrix4T<T>::Matrix4T(T m11, T m12, T m13, T m14, 
+				 T m21, T m22, T m23, T m24,
+				 T m31, T m32, T m33, T m34,
+				 T m41, T m42, T m43, T m44)
+{
+	//assign the arguments individually
+	mat[0][0] = m11;
+	mat[0][1] = m12;
+	mat[0][2] = m13;
+	mat[0][3] = m14;
+
+	mat[1][0] = m21;
+	mat[1][1] = m22;
+	mat[1][2] = m23;
+	mat[1][3] = m24;
+
+	mat[2][0] = m31;
+	mat[2][1] = m32;
+	mat[2][2] = m33;
+	mat[2][3] = m34;
+
+	mat[3][0] = m41;
+	mat[3][1] = m42;
+	mat[3][2] = m43;
+	mat[3][3] = m44;
+}
+
+//subscript operator
+TEMPLATE
+Vector4T<T> & Matrix4T<T>::operator[](const int index)
+{
+	switch (index)
+	{
+	case 0: return mat[0];
+	case 1: return mat[1];
+	case 2: return mat[2];
+	case 3: return mat[3];
+	default: throw;
+	}	
+}
+
+//cast to T pointer overload
+TEMPLATE
+Matrix4T<T>::operator T*()
+{
+	return &mat[0][0];
+}
+
+
+//multiplication operator
+TEMPLATE
+Matrix4T<T> Matrix4T<T>::operator*(const Matrix4T<T>& other)
+{
+	Matrix4T<T> product;
+
+	//a = Matrix4T<T> that this function is running through
+	//b = Matrix4T<T> other passed into the function
+
+	//every column of the product is a transformed by one of b's columns
+	for (int bn = 0; bn < 4; bn++)
+	{
+		const Vector4T<T>& column = other.mat[bn];
+
+		product.mat[bn].x = mat[0].x * column.x + mat[1].x * column.y + mat[2].x * column.z + mat[3].x * column.w;
+		product.mat[bn].y = mat[0].y * column.x + mat[1].y * column.y + mat[2].y * column.z + mat[3].y * column.w;
+		product.mat[bn].z = mat[0].z * column.x + mat[1].z * column.y + mat[2].z * column.z + mat[3].z * column.w;
+		product.mat[bn].w = mat[0].w * column.x + mat[1].w * column.y + mat[2].w * column.z + mat[3].w * column.w;
+	}
+
+	return product;
+}
+
+//convert to identity matrix
+TEMPLATE
+void Matrix4T<T>::identity()
+{
+	for (int i = 0; i < 4; i++)
+	{
+		for (int j = 0; j < 4; j++)
+		{
+			//checks if the iterators are on a diagonal
+			mat[i][j] = i == j ? 1.0f : 0.0f;
+		}
+	}
+}
+
+//3D homogeneous rotation matrix around X (YZ affected)
+TEMPLATE
+void Matrix4T<T>::setRotateX(T radians)
+{
+	identity(); //all other elements are reset
+	mat[1][1] = (T)cos(radians);
+	mat[1][2] = (T)sin(radians);
+	mat[2][1] = (T)-sin(radians);
+	mat[2][2] = (T)cos(radians);
+}
+
+//3D homogeneous rotation matrix around Y (XZ affected)
+TEMPLATE
+void Matrix4T<T>::setRotateY(T radians)
+{
+	identity(); //all other elements are reset
+	mat[0][0] = (T)cos(radians);
+	mat[0][2] = (T)-sin(radians);
+	mat[2][0] = (T)sin(radians);
+	mat[2][2] = (T)cos(radians);
+}
+
+//3D homogeneous rotation matrix around Z (XY affected)
+TEMPLATE
+void Matrix4T<T>::setRotateZ(T radians)
+{
+	identity(); //all other elements are reset
+	mat[0][0] = (T)cos(radians);
+	mat[0][1] = (T)sin(radians);
+	mat[1][0] = (T)-sin(radians);
+	mat[1][1] = (T)cos(radians);
+}
+
+//transpose matrix
+TEMPLATE
+void Matrix4T<T>::transpose()
+{
+	Matrix4T<T> temp = *this;
+
+	//write the columns of the copy back as rows
+	for (int i = 0; i < 4; i++)
+	{
+		mat[0][i] = temp.mat[i].x;
+		mat[1][i] = temp.mat[i].y;
+		mat[2][i] = temp.mat[i].z;
+		mat[3][i] = temp.mat[i].w;
+	}
+}
+
+
+//determinant from matrix
+TEMPLATE
+T Matrix4T<T>::determinant()
+{
+	/*
+	* (what each letter represents in the matrix)
+	* a b c d
+	* e f g h
+	* i j k l
+	* m n o p
+	*/
+
+	T a = mat[0].x, b = mat[0].y, c = mat[0].z, d = mat[0].w;
+	T e = mat[1].x, f = mat[1].y, g = mat[1].z, h = mat[1].w;
+	T i = mat[2].x, j = mat[2].y, k = mat[2].z, l = mat[2].w;
+	T m = mat[3].x, n = mat[3].y, o = mat[3].z, p = mat[3].w;
+
+	//2x2 determinants of the top two rows
+	T s0 = a * f - e * b;
+	T s1 = a * g - e * c;
+	T s2 = a * h - e * d;
+	T s3 = b * g - f * c;
+	T s4 = b * h - f * d;
+	T s5 = c * h - g * d;
+
+	//2x2 determinants of the bottom two rows
+	T c5 = k * p - o * l;
+	T c4 = j * p - n * l;
+	T c3 = j * o - n * k;
+	T c2 = i * p - m * l;
+	T c1 = i * o - m * k;
+	T c0 = i * n - m * j;
+
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+//invert the matrix
+TEMPLATE
+bool Matrix4T<T>::invert()
+{
+	//same lettering as determinant()
+	T a = mat[0].x, b = mat[0].y, c = mat[0].z, d = mat[0].w;
+	T e = mat[1].x, f = mat[1].y, g = mat[1].z, h = mat[1].w;
+	T i = mat[2].x, j = mat[2].y, k = mat[2].z, l = mat[2].w;
+	T m = mat[3].x, n = mat[3].y, o = mat[3].z, p = mat[3].w;
+
+	//2x2 determinants of the top two rows
+	T s0 = a * f - e * b;
+	T s1 = a * g - e * c;
+	T s2 = a * h - e * d;
+	T s3 = b * g - f * c;
+	T s4 = b * h - f * d;
+	T s5 = c * h - g * d;
+
+	//2x2 determinants of the bottom two rows
+	T c5 = k * p - o * l;
+	T c4 = j * p - n * l;
+	T c3 = j * o - n * k;
+	T c2 = i * p - m * l;
+	T c1 = i * o - m * k;
+	T c0 = i * n - m * j;
+
+	T determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+	//if the determinant is 0, the inversion wont work
+	if (determinant == 0)
+	{
+		return false;
+	}
+
+	T invDet = 1 / determinant;
+
+	//the adjugate (transposed cofactors) built from the 2x2 determinants, divided by the determinant of the 4x4
+	mat[0].x = ( f * c5 - g * c4 + h * c3) * invDet;
+	mat[0].y = (-b * c5 + c * c4 - d * c3) * invDet;
+	mat[0].z = ( n * s5 - o * s4 + p * s3) * invDet;
+	mat[0].w = (-j * s5 + k * s4 - l * s3) * invDet;
+
+	mat[1].x = (-e * c5 + g * c2 - h * c1) * invDet;
+	mat[1].y = ( a * c5 - c * c2 + d * c1) * invDet;
+	mat[1].z = (-m * s5 + o * s2 - p * s1) * invDet;
+	mat[1].w = ( i * s5 - k * s2 + l * s1) * invDet;
+
+	mat[2].x = ( e * c4 - f * c2 + h * c0) * invDet;
+	mat[2].y = (-a * c4 + b * c2 - d * c0) * invDet;
+	mat[2].z = ( m * s4 - n * s2 + p * s0) * invDet;
+	mat[2].w = (-i * s4 + j * s2 - l * s0) * invDet;
+
+	mat[3].x = (-e * c3 + f * c1 - g * c0) * invDet;
+	mat[3].y = ( a * c3 - b * c1 + c * c0) * invDet;
+	mat[3].z = (-m * s3 + n * s1 - o * s0) * invDet;
+	mat[3].w = ( i * s3 - j * s1 + k * s0) * invDet;
+
+	return true;
+}
+
+//3D scale matrix
+TEMPLATE
+void Matrix4T<T>::setScale(Vector3T<T> scale)
+{
+	identity(); //all other elements are reset
+
+	mat[0][0] = scale.x;
+	mat[1][1] = scale.y;
+	mat[2][2] = scale.z;
+}
+
+//3D translation matrix
+TEMPLATE
+void Matrix4T<T>::setTranslate(Vector3T<T> translate)
+{
+	identity(); //all other elements are reset
+
+	mat[3][0] = translate.x;
+	mat[3][1] = translate.y;
+	mat[3][2] = translate.z;
+}
+
+//applies a relative translation to a matrix
+TEMPLATE
+void Matrix4T<T>::translate(Vector3T<T> translate)
+{
+	mat[3][0] += translate.x;
+	mat[3][1] += translate.y;
+	mat[3][2] += translate.z;
+}
+
+//applies a relative scale to a matrix
+TEMPLATE
+void Matrix4T<T>::scale(Vector3T<T> scale)
+{
+	mat[0][0] *= scale.x;
+	mat[0][1] *= scale.x;
+	mat[0][2] *= scale.x;
+
+	mat[1][0] *= scale.y;
+	mat[1][1] *= scale.y;
+	mat[1][2] *= scale.y;
+
+	mat[2][0] *= scale.z;
+	mat[2][1] *= scale.z;
+	mat[2][2] *= scale.z;
+}
+
+//get scale from 4D matrix
+TEMPLATE
+Vector3T<T> Matrix4T<T>::getScale()
+{
+	//get the sign of the scale x
+	T signX = mat[0][0] > 0 ? (T)1 : (T)-1;
+	signX = mat[0][0] == 0 ? (T)0 : signX;
+
+	//get the sign of the scale y
+	T signY = mat[1][1] > 0 ? (T)1 : (T)-1;
+	signY = mat[1][1] == 0 ? (T)0 : signY;
+
+	//get the sign of the scale y
+	T signZ = mat[2][2] > 0 ? (T)1 : (T)-1;
+	signZ = mat[2][2] == 0 ? (T)0 : signZ;
+
+	//scale decomposition
+	T sX = signX * (T)sqrt(mat[0][0] * mat[0][0] + mat[0][1] * mat[0][1] + mat[0][2] * mat[0][2]);
+	T sY = signY * (T)sqrt(mat[1][0] * mat[1][0] + mat[1][1] * mat[1][1] + mat[1][2] * mat[1][2]);
+	T sZ = signZ * (T)sqrt(mat[2][0] * mat[2][0] + mat[2][1] * mat[2][1] + mat[2][2] * mat[2][2]);
+
+	return Vector3T<T>{sX, sY, sZ};
+}
+
+//applies a relative rotation (YZ affected) to a matrix
+TEMPLATE
+void Matrix4T<T>::rotateX(T radians)
+{
+	Matrix4T<T> other;
+	other.setRotateX(radians);
+
+	*this = other * *this;
+}
+
+//applies a relative rotation (XZ affected) to a matrix
+TEMPLATE
+void Matrix4T<T>::rotateY(T radians)
+{
+	Matrix4T<T> other;
+	other.setRotateY(radians);
+
+	*this = other * *this;
+}
+
+
+//applies a relative rotation (XY affected) to a matrix
+TEMPLATE
+void Matrix4T<T>::rotateZ(T radians)
+{
+	Matrix4T<T> other;
+	other.setRotateZ(radians);
+
+	*this = other * *this;
+}
+
+//rotates by Z, then Y, then X
+TEMPLATE
+void Matrix4T<T>::rotateEuler(Vector3T<T> angles)
+{
+	Matrix4T<T> X;
+	Matrix4T<T> Y;
+	Matrix4T<T> Z;
+
+	//individual rotations
+	X.setRotateX(angles.x);
+	Y.setRotateY(angles.y);
+	Z.setRotateZ(angles.z);
+
+	*this = X * Y * Z * *this;
+}
+
+
+//get the rotation around the X axis
+TEMPLATE
+T Matrix4T<T>::getRotationX()
+{
+	Vector3T<T> scaleVec = getScale();
+	scaleVec = 1 / scaleVec;
+
+	Matrix4T<T> copy = *this;
+	copy.scale(scaleVec); //normalise the matrix copy by applying an inverse scale
+
+	T roll = 0;
+
+	if (copy.mat[0][0] != 1 && copy.mat[0][0] != -1)
+	{
+		T roll = (T)atan2(-copy.mat[1][2], copy.mat[1][1]);
+	}
+
+	return roll;
+}
+
+//get the rotation around the Y axis
+TEMPLATE
+T Matrix4T<T>::getRotationY()
+{
+	Vector3T<T> scaleVec = getScale();
+	scaleVec = 1 / scaleVec;
+
+	Matrix4T<T> copy = *this;
+	copy.scale(scaleVec); //normalise the matrix copy by applying an inverse scale
+
+	T pitch = 0;
+
+	if (copy.mat[0][0] == 1 || copy.mat[0][0] == -1)
+	{
+		T pitch = (T)atan2(copy.mat[0][2], copy.mat[2][3]);
+	}
+	else
+	{
+		T pitch = (T)atan2(-copy.mat[2][0], copy.mat[0][0]);
+	}
+
+	return pitch;
+}
+
+//get the rotation around the Z axis
+TEMPLATE
+T Matrix4T<T>::getRotationZ()
+{
+	Vector3T<T> scaleVec = getScale();
+	scaleVec = 1 / scaleVec;
+
+	Matrix4T<T> copy = *this;
+	copy.scale(scaleVec); //normalise the matrix copy by applying an inverse scale
+
+	T yaw = 0;
+
+	if (copy.mat[0][0] != 1 && copy.mat[0][0] != -1)
+	{
+		T yaw = (T)asin(copy.mat[1][0]);
+	}
+
+	return yaw;
+}
+
+//gets all rotation as euler angles
+TEMPLATE
+Vector3T<T> Matrix4T<T>::getEuler()
+{
+	Vector3T<T> scaleVec = getScale();
+	scaleVec = 1 / scaleVec;
+
+	Matrix4T<T> copy = *this;
+	copy.scale(scaleVec); //normalise the matrix copy by applying an inverse scale
+
+	if (copy.mat[0][0] == 1 || copy.mat[0][0] == -1)
+	{
+		T pitch = (T)atan2(copy.mat[0][2], copy.mat[2][3]);
+		return Vector3T<T>{0, pitch, 0};
+	}
+	else
+	{
+		T yaw = (T)asin(copy.mat[0][1]);
+		T pitch = (T)atan2(-copy.mat[0][2], copy.mat[0][0]);
+		T roll = (T)atan2(-copy.mat[2][1], copy.mat[1][1]);
+
+		return Vector3T<T>{roll, pitch, yaw};
+	}
+}
+
+//generate an orientation that makes an observer at one point face another point
+TEMPLATE
+void Matrix4T<T>::lookAt(Vector3T<T> eye, Vector3T<T> target, Vector3T<T> up)
+{
+
+	Vector3T<T> zAxis = (target - eye).normalised();
+	Vector3T<T> xAxis = (up * -1).cross(zAxis).normalised();
+	Vector3T<T> yAxis = zAxis.cross(xAxis);
+
+	Matrix4T<T> look;
+
+	T xDot = -xAxis.dot(eye);
+	T yDot = -yAxis.dot(eye);
+	T zDot = -zAxis.dot(eye);
+
+	look.identity();
+
+	look[0][0] = xAxis.x;
+	look[0][1] = xAxis.y;
+	look[0][2] = xAxis.z;
+
+	look[1][0] = yAxis.x;
+	look[1][2] = yAxis.y;
+	look[1][2] = yAxis.z;
+
+	look[2][0] = zAxis.x;
+	look[2][1] = zAxis.y;
+	look[2][2] = zAxis.z;
+
+	look[0][3] = xDot;
+	look[1][3] = yDot;
+	look[2][3] = zDot;
+
+	*this = look;
+}
+
+//3D camera transformation
+TEMPLATE
+void Matrix4T<T>::generateProjection(T fovX, T fovY, T zNear, T zFar)
+{
+	Matrix4T<T> projection = Matrix4T<T>{};
+
+	projection[0][0] = (T)atan(fovX / 2);
+	projection[1][1] = (T)atan(fovY / 2);
+	projection[2][2] = -(zFar + zNear) / (zFar - zNear);
+	projection[3][2] = -(2 * zNear * zFar) / (zFar - zNear);
+	projection[2][3] = -1;
+	projection[3][3] = 0;
+
+	*this = projection;
+}
+
+
+#ifdef MATHSLIBRARY_SIMD
+//multiplication operator (SSE)
+template<>
+MATHSLIBRARY_INLINE Matrix4T<float> Matrix4T<float>::operator*(const Matrix4T<float>& other)
+{
+	__m128 col0 = _mm_loadu_ps(&mat[0].x);
+	__m128 col1 = _mm_loadu_ps(&mat[1].x);
+	__m128 col2 = _mm_loadu_ps(&mat[2].x);
+	__m128 col3 = _mm_loadu_ps(&mat[3].x);
+
+	Matrix4T<float> product;
+
+	//every column of the product is a transformed by one of b's columns
+	for (int bn = 0; bn < 4; bn++)
+	{
+		const Vector4T<float>& column = other.mat[bn];
+
+		__m128 sum = _mm_mul_ps(col0, _mm_set1_ps(column.x));
+		sum = _mm_add_ps(sum, _mm_mul_ps(col1, _mm_set1_ps(column.y)));
+		sum = _mm_add_ps(sum, _mm_mul_ps(col2, _mm_set1_ps(column.z)));
+		sum = _mm_add_ps(sum, _mm_mul_ps(col3, _mm_set1_ps(column.w)));
+
+		_mm_storeu_ps(&product.mat[bn].x, sum);
+	}
+
+	return product;
+}
+
+//transpose matrix (SSE)
+template<>
+MATHSLIBRARY_INLINE void Matrix4T<float>::transpose()
+{
+	__m128 row0 = _mm_loadu_ps(&mat[0].x);
+	__m128 row1 = _mm_loadu_ps(&mat[1].x);
+	__m128 row2 = _mm_loadu_ps(&mat[2].x);
+	__m128 row3 = _mm_loadu_ps(&mat[3].x);
+
+	_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+	_mm_storeu_ps(&mat[0].x, row0);
+	_mm_storeu_ps(&mat[1].x, row1);
+	_mm_storeu_ps(&mat[2].x, row2);
+	_mm_storeu_ps(&mat[3].x, row3);
+}
+
+//determinant from matrix (SSE)
+template<>
+MATHSLIBRARY_INLINE float Matrix4T<float>::determinant()
+{
+	__m128 row0 = _mm_loadu_ps(&mat[0].x);
+	__m128 row1 = _mm_loadu_ps(&mat[1].x);
+	__m128 row2 = _mm_loadu_ps(&mat[2].x);
+	__m128 row3 = _mm_loadu_ps(&mat[3].x);
+
+	//split the matrix into four 2x2 blocks
+	//| A B |
+	//| C D |
+	__m128 A = _mm_movelh_ps(row0, row1);
+	__m128 B = _mm_movehl_ps(row1, row0);
+	__m128 C = _mm_movelh_ps(row2, row3);
+	__m128 D = _mm_movehl_ps(row3, row2);
+
+	//determinants of the blocks as (|A|, |B|, |C|, |D|)
+	__m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, SIMD_SHUFFLE_MASK(0, 2, 0, 2)), _mm_shuffle_ps(row1, row3, SIMD_SHUFFLE_MASK(1, 3, 1, 3))),
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, SIMD_SHUFFLE_MASK(1, 3, 1, 3)), _mm_shuffle_ps(row1, row3, SIMD_SHUFFLE_MASK(0, 2, 0, 2))));
+
+	//|M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	__m128 productAD_BC = _mm_mul_ps(detSub, SIMD_SWIZZLE(detSub, 3, 2, 1, 0));
+	__m128 trace = simdHorizontalSum(_mm_mul_ps(simdMat2AdjMul(A, B), SIMD_SWIZZLE(simdMat2AdjMul(D, C), 0, 2, 1, 3)));
+
+	return _mm_cvtss_f32(productAD_BC) + _mm_cvtss_f32(SIMD_SWIZZLE(productAD_BC, 1, 1, 1, 1)) - _mm_cvtss_f32(trace);
+}
+
+//invert the matrix (SSE)
+//block-wise inverse, the matrix is treated as four 2x2 matrices
+template<>
+MATHSLIBRARY_INLINE bool Matrix4T<float>::invert()
+{
+	__m128 row0 = _mm_loadu_ps(&mat[0].x);
+	__m128 row1 = _mm_loadu_ps(&mat[1].x);
+	__m128 row2 = _mm_loadu_ps(&mat[2].x);
+	__m128 row3 = _mm_loadu_ps(&mat[3].x);
+
+	//split the matrix into four 2x2 blocks
+	//| A B |
+	//| C D |
+	__m128 A = _mm_movelh_ps(row0, row1);
+	__m128 B = _mm_movehl_ps(row1, row0);
+	__m128 C = _mm_movelh_ps(row2, row3);
+	__m128 D = _mm_movehl_ps(row3, row2);
+
+	//determinants of the blocks as (|A|, |B|, |C|, |D|)
+	__m128 detSub = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, SIMD_SHUFFLE_MASK(0, 2, 0, 2)), _mm_shuffle_ps(row1, row3, SIMD_SHUFFLE_MASK(1, 3, 1, 3))),
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, SIMD_SHUFFLE_MASK(1, 3, 1, 3)), _mm_shuffle_ps(row1, row3, SIMD_SHUFFLE_MASK(0, 2, 0, 2))));
+
+	__m128 detA = SIMD_SWIZZLE(detSub, 0, 0, 0, 0);
+	__m128 detB = SIMD_SWIZZLE(detSub, 1, 1, 1, 1);
+	__m128 detC = SIMD_SWIZZLE(detSub, 2, 2, 2, 2);
+	__m128 detD = SIMD_SWIZZLE(detSub, 3, 3, 3, 3);
+
+	__m128 D_C = simdMat2AdjMul(D, C);
+	__m128 A_B = simdMat2AdjMul(A, B);
+
+	//|M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+	__m128 trace = simdHorizontalSum(_mm_mul_ps(A_B, SIMD_SWIZZLE(D_C, 0, 2, 1, 3)));
+	__m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+	//if the determinant is 0, the inversion wont work
+	if (_mm_cvtss_f32(detM) == 0)
+	{
+		return false;
+	}
+
+	//adjugates of the four blocks of the inverse
+	__m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), simdMat2Mul(B, D_C));
+	__m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), simdMat2Mul(C, A_B));
+	__m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), simdMat2MulAdj(D, A_B));
+	__m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), simdMat2MulAdj(A, D_C));
+
+	//(1/|M|, -1/|M|, -1/|M|, 1/|M|), the signs apply the adjugate
+	__m128 invDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+
+	X_ = _mm_mul_ps(X_, invDetM);
+	Y_ = _mm_mul_ps(Y_, invDetM);
+	Z_ = _mm_mul_ps(Z_, invDetM);
+	W_ = _mm_mul_ps(W_, invDetM);
+
+	//undo the adjugates and reassemble the rows
+	_mm_storeu_ps(&mat[0].x, _mm_shuffle_ps(X_, Y_, SIMD_SHUFFLE_MASK(3, 1, 3, 1)));
+	_mm_storeu_ps(&mat[1].x, _mm_shuffle_ps(X_, Y_, SIMD_SHUFFLE_MASK(2, 0, 2, 0)));
+	_mm_storeu_ps(&mat[2].x, _mm_shuffle_ps(Z_, W_, SIMD_SHUFFLE_MASK(3, 1, 3, 1)));
+	_mm_storeu_ps(&mat[3].x, _mm_shuffle_ps(Z_, W_, SIMD_SHUFFLE_MASK(2, 0, 2, 0)));
+
+	return true;
+}
+
+//matrix transformation (SSE)
+template<>
+MATHSLIBRARY_INLINE Vector4T<float> Vector4T<float>::operator*(const Matrix4T<float>& matrix)
+{
+	const Vector4T<float>* m = matrix.mat;
+
+	__m128 sum = _mm_mul_ps(_mm_loadu_ps(&m[0].x), _mm_set1_ps(x));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[1].x), _mm_set1_ps(y)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[2].x), _mm_set1_ps(z)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&m[3].x), _mm_set1_ps(w)));
+
+	Vector4T<float> product;
+	_mm_storeu_ps(&product.x, sum);
+
+	return product;
+}
+#endif
\ No newline at end of file
@@ -531,3 +531,8 @@ Vector2T<T> operator*(Matrix2T<T> matrix, Vector2T<T> vector)
 
 	return product;
 }
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Vector2.inl"
+#endif
\ No newline at end of file
@@ -184,10 +184,10 @@ public:
 	* operator *
 	* multiplies a vector by a transformation matrix
 	*
-	* @param const Matrix3T matrix - the matrix to transform the vector with
+	* @param const Matrix3T& matrix - the matrix to transform the vector with
 	* @returns Vector3T - the resultant
 	*/
-	MATHSLIBRARY_API Vector3T operator*(const Matrix3T<T> matrix);
+	MATHSLIBRARY_API Vector3T operator*(const Matrix3T<T>& matrix);
 
 	#pragma region swizzling
 	/*
@@ -1290,31 +1290,22 @@ Vector3T<T> operator/(const float scalar, const Vector3T<T> vector)
 * template function
 * multiplies a vector by a transformation matrix
 *
-* @param Matrix3T<T> matrix - the matrix to transform the vector with
+* @param const Matrix3T<T>& matrix - the matrix to transform the vector with
 * @param Vector3T<T> vector - the vector to copy and apply the transformation to
 * @returns Vector3T<T> - the resultant
 */
 TEMPLATE
-Vector3T<T> operator*(Matrix3T<T> matrix, Vector3T<T> vector);
+Vector3T<T> operator*(const Matrix3T<T>& matrix, Vector3T<T> vector);
 
 //matrix transformation (reordered)
 TEMPLATE
-Vector3T<T> operator*(Matrix3T<T> matrix, Vector3T<T> vector)
+Vector3T<T> operator*(const Matrix3T<T>& matrix, Vector3T<T> vector)
 {
-	Vector3T<T> product = {};
-
-	//a = Vector3T<T> vector passed into the function
-	//b = Matrix3 matrix passed into the function
-
-	//iterate across b's columns and a's rows
-	for (int bn = 0; bn < 3; bn++)
-	{
-		//iterate across a's rows and b's columns
-		for (int i = 0; i < 3; i++)
-		{
-			product[bn] = product[bn] + vector[i] * matrix.mat[i][bn];
-		}
-	}
-
-	return product;
+	//both orders apply the same transformation
+	return vector * matrix;
 }
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Vector3.inl"
+#endif
\ No newline at end of file
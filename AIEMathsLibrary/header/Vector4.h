@@ -1,6 +1,7 @@
 #pragma once
 #include <math.h>
 #include "dllmain.h"
+#include "simd.h"
 
 #define TEMPLATE template<typename T>
 
@@ -189,10 +190,10 @@ public:
 	* operator *
 	* multiplies a vector by a transformation matrix
 	*
-	* @param const Matrix4T matrix - the matrix to transform the vector with
+	* @param const Matrix4T& matrix - the matrix to transform the vector with
 	* @returns Vector4T - the resultant
 	*/
-	MATHSLIBRARY_API Vector4T operator*(const Matrix4T<T> matrix);
+	MATHSLIBRARY_API Vector4T operator*(const Matrix4T<T>& matrix);
 
 	#pragma region swizzling
 	/*
@@ -3217,6 +3218,15 @@ public:
 
 using Vector4 = Vector4T<float>;
 
+#ifdef MATHSLIBRARY_SIMD
+//SSE versions of the float instantiation, defined in Vector4.inl
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Vector4T<float> Vector4T<float>::operator+(const Vector4T<float> other);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE void Vector4T<float>::operator+=(const Vector4T<float> other);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Vector4T<float> Vector4T<float>::operator-(const Vector4T<float> other);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE Vector4T<float> Vector4T<float>::operator*(const float scalar);
+template<> MATHSLIBRARY_API MATHSLIBRARY_INLINE float Vector4T<float>::dot(const Vector4T<float> other);
+#endif
+
 /*
 * operator *
 * template function
@@ -3264,31 +3274,22 @@ Vector4T<T> operator/(const float scalar, const Vector4T<T> vector)
 * template function
 * multiplies a vector by a transformation matrix
 *
-* @param Matrix4T<T> matrix - the matrix to transform the vector with
+* @param const Matrix4T<T>& matrix - the matrix to transform the vector with
 * @param Vector4T<T> vector - the vector to copy and apply the transformation to
 * @returns Vector4T<T> - the resultant
 */
 TEMPLATE
-Vector4T<T> operator*(Matrix4T<T> matrix, Vector4T<T> vector);
+Vector4T<T> operator*(const Matrix4T<T>& matrix, Vector4T<T> vector);
 
 //matrix transformation (reordered)
 TEMPLATE
-Vector4T<T> operator*(Matrix4T<T> matrix, Vector4T<T> vector)
+Vector4T<T> operator*(const Matrix4T<T>& matrix, Vector4T<T> vector)
 {
-	Vector4T<T> product = {};
-
-	//a = Vector4T<T> vector passed into the function
-	//b = Matrix4 matrix passed into the function
-
-	//iterate across b's columns and a's rows
-	for (int bn = 0; bn < 4; bn++)
-	{
-		//iterate across a's rows and b's columns
-		for (int i = 0; i < 4; i++)
-		{
-			product[bn] = product[bn] + vector[i] * matrix.mat[i][bn];
-		}
-	}
-
-	return product;
+	//both orders apply the same transformation
+	return vector * matrix;
 }
+
+//header-only builds pull the template definitions in with the declarations
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#include "Vector4.inl"
+#endif
\ No newline at end of file
@@ -1,6 +1,19 @@
 #pragma once
-#ifdef MATHSLIBRARY_EXPORTS
+//MATHSLIBRARY_HEADER_ONLY - define this in the consuming project to compile the library
+//directly into it, every function is then visible to (and inlinable by) the compiler
+//and the AIEMathsLibrary lib/dll does not need to be linked
+#if defined(MATHSLIBRARY_HEADER_ONLY)
+#define MATHSLIBRARY_API
+#elif defined(MATHSLIBRARY_EXPORTS)
 #define MATHSLIBRARY_API __declspec(dllexport)
 #else
 #define MATHSLIBRARY_API  
 #endif
+
+//non-template definitions living in the .inl files (eg. explicit specialisations)
+//must be inline when they get compiled into every including translation unit
+#ifdef MATHSLIBRARY_HEADER_ONLY
+#define MATHSLIBRARY_INLINE inline
+#else
+#define MATHSLIBRARY_INLINE
+#endif
\ No newline at end of file
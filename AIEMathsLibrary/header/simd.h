@@ -0,0 +1,184 @@
+#pragma once
+#include "dllmain.h"
+
+//MATHSLIBRARY_SIMD - defined when SSE can be used for the float instantiations
+//x64 always has SSE, x86 needs /arch:SSE or higher, define MATHSLIBRARY_NO_SIMD to force the scalar templates
+#if !defined(MATHSLIBRARY_NO_SIMD) && (defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1) || defined(__SSE__))
+#define MATHSLIBRARY_SIMD
+#endif
+
+#ifdef MATHSLIBRARY_SIMD
+#include <xmmintrin.h>
+
+//builds the immediate for _mm_shuffle_ps, the lanes are listed in memory order (x, y, z, w)
+#define SIMD_SHUFFLE_MASK(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+
+//shuffles the lanes of one register
+#define SIMD_SWIZZLE(vec, x, y, z, w) _mm_shuffle_ps(vec, vec, SIMD_SHUFFLE_MASK(x, y, z, w))
+
+/*
+* simdStore3
+*
+* writes the x, y and z lanes of a register without touching the memory after them
+*
+* @param float* destination - the 3 floats to write to
+* @param __m128 vec - the register to write from
+* @returns void
+*/
+inline void simdStore3(float* destination, __m128 vec)
+{
+	_mm_storel_pi((__m64*)destination, vec);
+	_mm_store_ss(destination + 2, _mm_movehl_ps(vec, vec));
+}
+
+/*
+* simdHorizontalSum
+*
+* adds the four lanes of a register together
+*
+* @param __m128 vec - the register to sum
+* @returns __m128 - the sum, copied into every lane
+*/
+inline __m128 simdHorizontalSum(__m128 vec)
+{
+	__m128 sum = _mm_add_ps(vec, SIMD_SWIZZLE(vec, 2, 3, 0, 1));
+	return _mm_add_ps(sum, SIMD_SWIZZLE(sum, 1, 0, 3, 2));
+}
+
+/*
+* simdMat2Mul
+*
+* multiplies two row-major 2x2 matrices stored as (m11, m12, m21, m22)
+* used by the block-wise 4x4 inverse
+*
+* @param __m128 a - the first matrix
+* @param __m128 b - the second matrix
+* @returns __m128 - a * b
+*/
+inline __m128 simdMat2Mul(__m128 a, __m128 b)
+{
+	return _mm_add_ps(_mm_mul_ps(a, SIMD_SWIZZLE(b, 0, 3, 0, 3)),
+					  _mm_mul_ps(SIMD_SWIZZLE(a, 1, 0, 3, 2), SIMD_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/*
+* simdMat2AdjMul
+*
+* multiplies the adjugate of a row-major 2x2 matrix by another 2x2 matrix
+*
+* @param __m128 a - the matrix to take the adjugate of
+* @param __m128 b - the second matrix
+* @returns __m128 - adj(a) * b
+*/
+inline __m128 simdMat2AdjMul(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(SIMD_SWIZZLE(a, 3, 3, 0, 0), b),
+					  _mm_mul_ps(SIMD_SWIZZLE(a, 1, 1, 2, 2), SIMD_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+/*
+* simdMat2MulAdj
+*
+* multiplies a row-major 2x2 matrix by the adjugate of another 2x2 matrix
+*
+* @param __m128 a - the first matrix
+* @param __m128 b - the matrix to take the adjugate of
+* @returns __m128 - a * adj(b)
+*/
+inline __m128 simdMat2MulAdj(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(a, SIMD_SWIZZLE(b, 3, 0, 3, 0)),
+					  _mm_mul_ps(SIMD_SWIZZLE(a, 1, 0, 3, 2), SIMD_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/*
+* simdTransform2
+*
+* applies a 2D affine transformation to an array of interleaved (x, y) pairs,
+* two points are transformed per register
+* the destination may be the same array as the source
+*
+* @param __m128 xAxis - the first column of the linear part, repeated as (x, y, x, y)
+* @param __m128 yAxis - the second column of the linear part, repeated as (x, y, x, y)
+* @param __m128 translation - the translation repeated as (x, y, x, y), zero for directions
+* @param const float* source - the pairs to transform
+* @param float* destination - where the transformed pairs are written
+* @param size_t count - the number of pairs
+* @returns void
+*/
+inline void simdTransform2(__m128 xAxis, __m128 yAxis, __m128 translation, const float* source, float* destination, size_t count)
+{
+	size_t i = 0;
+
+	for (; i + 2 <= count; i += 2)
+	{
+		__m128 points = _mm_loadu_ps(source + i * 2);
+
+		__m128 result = _mm_add_ps(_mm_mul_ps(SIMD_SWIZZLE(points, 0, 0, 2, 2), xAxis),
+								   _mm_mul_ps(SIMD_SWIZZLE(points, 1, 1, 3, 3), yAxis));
+
+		_mm_storeu_ps(destination + i * 2, _mm_add_ps(result, translation));
+	}
+
+	//odd point out, only touch the two floats that belong to it
+	if (i < count)
+	{
+		__m128 points = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(source + i * 2));
+
+		__m128 result = _mm_add_ps(_mm_mul_ps(SIMD_SWIZZLE(points, 0, 0, 2, 2), xAxis),
+								   _mm_mul_ps(SIMD_SWIZZLE(points, 1, 1, 3, 3), yAxis));
+
+		_mm_storel_pi((__m64*)(destination + i * 2), _mm_add_ps(result, translation));
+	}
+}
+
+/*
+* simdTransform2SoA
+*
+* applies a 2D affine transformation to points stored as separate x and y arrays,
+* four points are transformed per register
+* the destination arrays may be the same as the source arrays
+*
+* @param const float* matrix - (xAxis.x, xAxis.y, yAxis.x, yAxis.y, translation.x, translation.y)
+* @param const float* xs - the x components to transform
+* @param const float* ys - the y components to transform
+* @param float* destinationXs - where the transformed x components are written
+* @param float* destinationYs - where the transformed y components are written
+* @param size_t count - the number of points
+* @returns void
+*/
+inline void simdTransform2SoA(const float* matrix, const float* xs, const float* ys, float* destinationXs, float* destinationYs, size_t count)
+{
+	__m128 m00 = _mm_set1_ps(matrix[0]);
+	__m128 m01 = _mm_set1_ps(matrix[1]);
+	__m128 m10 = _mm_set1_ps(matrix[2]);
+	__m128 m11 = _mm_set1_ps(matrix[3]);
+	__m128 tx = _mm_set1_ps(matrix[4]);
+	__m128 ty = _mm_set1_ps(matrix[5]);
+
+	size_t i = 0;
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 x = _mm_loadu_ps(xs + i);
+		__m128 y = _mm_loadu_ps(ys + i);
+
+		//both results are worked out before either is stored in case the arrays are shared
+		__m128 resultX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), tx);
+		__m128 resultY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), ty);
+
+		_mm_storeu_ps(destinationXs + i, resultX);
+		_mm_storeu_ps(destinationYs + i, resultY);
+	}
+
+	//leftover points
+	for (; i < count; i++)
+	{
+		float x = xs[i];
+		float y = ys[i];
+
+		destinationXs[i] = x * matrix[0] + y * matrix[2] + matrix[4];
+		destinationYs[i] = x * matrix[1] + y * matrix[3] + matrix[5];
+	}
+}
+#endif
@@ -0,0 +1,7 @@
+#include "Affine2.h"
+#include "Affine2.inl"
+
+//all of the decimal types
+template class Affine2T<float>;
+template class Affine2T<double>;
+template class Affine2T<long double>;
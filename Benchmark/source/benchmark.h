@@ -0,0 +1,121 @@
+#pragma once
+#include <chrono>
+#include <stdlib.h>
+
+/*
+* class Stopwatch
+*
+* measures the time since it was started using the steady clock
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class Stopwatch
+{
+public:
+
+	/*
+	* Stopwatch()
+	* default constructor - starts timing straight away
+	*/
+	Stopwatch() { restart(); };
+
+	/*
+	* restart
+	*
+	* starts timing from now
+	*
+	* @returns void
+	*/
+	void restart() { start = std::chrono::steady_clock::now(); };
+
+	/*
+	* milliseconds
+	*
+	* gets the time since the stopwatch was (re)started
+	*
+	* @returns double - the elapsed time in milliseconds
+	*/
+	double milliseconds()
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	};
+
+protected:
+
+	std::chrono::steady_clock::time_point start; //when timing started
+};
+
+/*
+* randomFloat
+*
+* gets a random float in a range, the benchmarks seed rand so every run uses the same data
+*
+* @param float min - the smallest value
+* @param float max - the biggest value
+* @returns float - the random value
+*/
+inline float randomFloat(float min, float max)
+{
+	return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+/*
+* benchmarkMaths
+*
+* times the vector and matrix operations used on the transform and collision
+* hot paths, so the header-only build can be compared with the lib/dll builds
+*
+* @returns void
+*/
+void benchmarkMaths();
+
+/*
+* benchmarkNarrowphase
+*
+* times the collision solver on every type of pair of shapes, once through its dispatch
+* table and once with every pair sent to SAT, and counts the heap allocations made
+* by the tests, build with COLLISION_COUNT_ALLOCATIONS to count them
+*
+* @returns void
+*/
+void benchmarkNarrowphase();
+
+/*
+* benchmarkBroadphase
+*
+* times registering, moving and querying 1k, 10k and 100k bodies with the
+* partition's grid and with its AABB tree
+*
+* @returns void
+*/
+void benchmarkBroadphase();
+
+/*
+* benchmarkSorts
+*
+* times the sorts in sorter.h against std::sort and std::stable_sort on
+* 10^3 to 10^7 random and nearly sorted items
+*
+* @returns void
+*/
+void benchmarkSorts();
+
+/*
+* benchmarkPaths
+*
+* times finding paths by walking the tree of a generated map against searching
+* the same map with A*, on maps split 2 to 14 times
+*
+* @returns void
+*/
+void benchmarkPaths();
+
+/*
+* benchmarkThreads
+*
+* times handing work out to the thread pool, and checks that a pool which
+* has already run work still splits it correctly after its thread count changes
+*
+* @returns void
+*/
+void benchmarkThreads();
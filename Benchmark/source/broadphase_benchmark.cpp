@@ -0,0 +1,108 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+
+#include "partition.h"
+#include "base_entity.h"
+#include "AABB.h"
+
+//how many times every body is moved while the moves are timed
+#define BROADPHASE_MOVE_ROUNDS 10
+
+//every body gets this much room on average, so the density is the same for every body count
+#define BROADPHASE_AREA_PER_BODY 40.0f
+
+//times registering, moving and querying the same bodies with one type of broadphase
+static void timeBroadphase(BroadphaseType type, const char* name, size_t count)
+{
+	//the same bodies for every type of broadphase
+	srand((unsigned int)count);
+
+	float side = BROADPHASE_AREA_PER_BODY * sqrtf((float)count);
+
+	SpatialPartition world;
+	world.root = nullptr;
+	world.nodeSize = 64.0f;
+	world.iLength = (int)(side / world.nodeSize) + 1;
+	world.jLength = world.iLength;
+	world.broadphase = type;
+	world.initialisePartition();
+
+	std::vector<BaseEntity*> bodies(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		Vector2 extents{ randomFloat(5.0f, 15.0f), randomFloat(5.0f, 15.0f) };
+
+		//one in fifty is long like a car or a projectile, too big for the grid's nodes
+		if (i % 50 == 0)
+		{
+			extents = Vector2{ randomFloat(200.0f, 400.0f), 10.0f };
+		}
+
+		bodies[i] = new BaseEntity(new AABB(extents * -1.0f, extents));
+		bodies[i]->collider->transform.translation = Vector2{ randomFloat(0.0f, side), randomFloat(0.0f, side) };
+		bodies[i]->collider->transform.updateGlobalTransform();
+	}
+
+	Stopwatch stopwatch;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		world.registerCollider(bodies[i], true);
+	}
+
+	double registerTime = stopwatch.milliseconds();
+
+	//small moves, like a frame of movement
+	std::vector<Vector2> moves(count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		moves[i] = Vector2{ randomFloat(-8.0f, 8.0f), randomFloat(-8.0f, 8.0f) };
+	}
+
+	stopwatch.restart();
+
+	for (int round = 0; round < BROADPHASE_MOVE_ROUNDS; round++)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			//go back and forth so the bodies stay in the same area
+			Transform& transform = bodies[i]->collider->transform;
+			transform.translation += round % 2 == 0 ? moves[i] : moves[i] * -1.0f;
+			transform.updateGlobalTransform();
+
+			world.moveCollider(bodies[i]);
+		}
+	}
+
+	double moveTime = stopwatch.milliseconds() / BROADPHASE_MOVE_ROUNDS;
+
+	size_t candidates = 0;
+	stopwatch.restart();
+
+	for (size_t i = 0; i < count; i++)
+	{
+		candidates += world.getNeighbours(bodies[i]).size();
+	}
+
+	double queryTime = stopwatch.milliseconds();
+
+	printf("%7zu bodies %-5s  register %9.2f ms   move all %9.2f ms   query all %9.2f ms   %6.2f candidates/body\n",
+		count, name, registerTime, moveTime, queryTime, (double)candidates / count);
+}
+
+//times the grid and the tree with more and more bodies
+void benchmarkBroadphase()
+{
+	size_t counts[] = { 1000, 10000, 100000 };
+
+	for (size_t count : counts)
+	{
+		timeBroadphase(BroadphaseType::GRID, "grid", count);
+		timeBroadphase(BroadphaseType::TREE, "tree", count);
+	}
+}
@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+
+//a named part of the benchmark that can be run on its own
+struct BenchmarkSection
+{
+	const char* name;
+	void(*run)();
+};
+
+const BenchmarkSection sections[] =
+{
+	{ "maths", benchmarkMaths },
+	{ "narrowphase", benchmarkNarrowphase },
+	{ "broadphase", benchmarkBroadphase },
+	{ "sorts", benchmarkSorts },
+	{ "paths", benchmarkPaths },
+	{ "threads", benchmarkThreads },
+};
+
+//runs every section, or only the sections named on the command line
+int main(int argc, char** argv)
+{
+	size_t sectionCount = sizeof(sections) / sizeof(sections[0]);
+
+	for (size_t i = 0; i < sectionCount; i++)
+	{
+		bool selected = argc <= 1;
+
+		for (int j = 1; j < argc; j++)
+		{
+			if (strcmp(argv[j], sections[i].name) == 0)
+			{
+				selected = true;
+			}
+		}
+
+		if (!selected)
+		{
+			continue;
+		}
+
+		printf("== %s\n", sections[i].name);
+
+		//every section starts from the same random numbers
+		srand(1);
+		sections[i].run();
+
+		printf("\n");
+	}
+
+	return 0;
+}
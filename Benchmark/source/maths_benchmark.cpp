@@ -0,0 +1,188 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <vector>
+
+#include "Vector2.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix3.h"
+#include "Matrix4.h"
+#include "Affine2.h"
+
+//how many different values each operation cycles through, small enough to stay in the cache
+#define MATHS_VALUE_COUNT 1024
+
+//how many times each operation is called
+#define MATHS_CALL_COUNT 4000000
+
+//prints how long one call took on average, check stops the compiler throwing the work away
+static void printTiming(const char* name, double milliseconds, float check)
+{
+	printf("%-28s %8.2f ns/call   (check %g)\n", name, milliseconds * 1000000.0 / MATHS_CALL_COUNT, check);
+}
+
+//times the maths library one operation at a time
+void benchmarkMaths()
+{
+#ifdef MATHSLIBRARY_HEADER_ONLY
+	printf("maths library: header-only\n");
+#else
+	printf("maths library: lib/dll\n");
+#endif
+
+	std::vector<Vector2> vectors(MATHS_VALUE_COUNT);
+	std::vector<Vector3> vectors3(MATHS_VALUE_COUNT);
+	std::vector<Matrix3> matrices(MATHS_VALUE_COUNT);
+	std::vector<Matrix4> matrices4(MATHS_VALUE_COUNT);
+	std::vector<Affine2> affines(MATHS_VALUE_COUNT);
+
+	for (size_t i = 0; i < MATHS_VALUE_COUNT; i++)
+	{
+		vectors[i] = Vector2{ randomFloat(-100.0f, 100.0f), randomFloat(-100.0f, 100.0f) };
+		vectors3[i] = Vector3{ vectors[i].x, vectors[i].y, 1.0f };
+
+		matrices[i].setRotateZ(randomFloat(-3.0f, 3.0f));
+		matrices[i][2][0] = randomFloat(-100.0f, 100.0f);
+		matrices[i][2][1] = randomFloat(-100.0f, 100.0f);
+
+		matrices4[i].setRotateZ(randomFloat(-3.0f, 3.0f));
+		matrices4[i][3][0] = randomFloat(-100.0f, 100.0f);
+
+		affines[i].setTRS(vectors[i], randomFloat(-3.0f, 3.0f), Vector2{ 1.0f, 1.0f });
+	}
+
+	Stopwatch stopwatch;
+
+	//every result feeds the next call so nothing can be hoisted out of the loop
+	{
+		float sum = 0.0f;
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			sum += vectors[i % MATHS_VALUE_COUNT].dot(vectors[(i + 1) % MATHS_VALUE_COUNT]);
+		}
+
+		printTiming("Vector2::dot", stopwatch.milliseconds(), sum);
+	}
+
+	{
+		Vector2 total{ 0.0f, 0.0f };
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			total = total + vectors[i % MATHS_VALUE_COUNT];
+		}
+
+		printTiming("Vector2::operator+", stopwatch.milliseconds(), total.x + total.y);
+	}
+
+	{
+		float sum = 0.0f;
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			Vector2 vector = vectors[i % MATHS_VALUE_COUNT];
+			vector.normalise();
+			sum += vector.x;
+		}
+
+		printTiming("Vector2::normalise", stopwatch.milliseconds(), sum);
+	}
+
+	{
+		Vector3 total{ 0.0f, 0.0f, 0.0f };
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			total += matrices[i % MATHS_VALUE_COUNT] * vectors3[i % MATHS_VALUE_COUNT];
+		}
+
+		printTiming("Matrix3 * Vector3", stopwatch.milliseconds(), total.x + total.y + total.z);
+	}
+
+	{
+		Matrix3 total;
+		total.identity();
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			total = matrices[i % MATHS_VALUE_COUNT] * total;
+			total[2][0] = 0.0f;
+			total[2][1] = 0.0f;
+		}
+
+		printTiming("Matrix3 * Matrix3", stopwatch.milliseconds(), total[0][0] + total[1][0]);
+	}
+
+	{
+		float sum = 0.0f;
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			Matrix3 matrix = matrices[i % MATHS_VALUE_COUNT];
+			matrix.invert();
+			sum += matrix[2][0];
+		}
+
+		printTiming("Matrix3::invert", stopwatch.milliseconds(), sum);
+	}
+
+	{
+		float sum = 0.0f;
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			sum += matrices[i % MATHS_VALUE_COUNT].determinant();
+		}
+
+		printTiming("Matrix3::determinant", stopwatch.milliseconds(), sum);
+	}
+
+	{
+		float sum = 0.0f;
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			Matrix3 matrix = matrices[i % MATHS_VALUE_COUNT];
+			matrix.transpose();
+			sum += matrix[0][2];
+		}
+
+		printTiming("Matrix3::transpose", stopwatch.milliseconds(), sum);
+	}
+
+	{
+		Matrix4 total;
+		total.identity();
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			total = matrices4[i % MATHS_VALUE_COUNT] * total;
+			total[3][0] = 0.0f;
+		}
+
+		printTiming("Matrix4 * Matrix4", stopwatch.milliseconds(), total[0][0] + total[1][0]);
+	}
+
+	{
+		Vector2 total{ 0.0f, 0.0f };
+		stopwatch.restart();
+
+		for (size_t i = 0; i < MATHS_CALL_COUNT; i++)
+		{
+			total += affines[i % MATHS_VALUE_COUNT].transformPoint(vectors[i % MATHS_VALUE_COUNT]);
+		}
+
+		printTiming("Affine2::transformPoint", stopwatch.milliseconds(), total.x + total.y);
+	}
+}
@@ -0,0 +1,192 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <vector>
+
+#include "collision.h"
+#include "circle.h"
+#include "AABB.h"
+#include "polygon.h"
+
+//how many different pairs of each type are tested
+#define NARROWPHASE_PAIR_COUNT 1024
+
+//how many tests are timed for each type of pair
+#define NARROWPHASE_TEST_COUNT 1000000
+
+//a kind of shape to put in the pairs
+enum class BenchmarkShape
+{
+	CIRCLE,
+	AABB,
+	ROTATED_AABB,
+	POLYGON,
+};
+
+//a type of pair to time
+struct NarrowphaseCase
+{
+	const char* name;
+	BenchmarkShape A;
+	BenchmarkShape B;
+};
+
+const NarrowphaseCase narrowphaseCases[] =
+{
+	{ "circle/circle", BenchmarkShape::CIRCLE, BenchmarkShape::CIRCLE },
+	{ "circle/AABB", BenchmarkShape::CIRCLE, BenchmarkShape::AABB },
+	{ "AABB/circle", BenchmarkShape::AABB, BenchmarkShape::CIRCLE },
+	{ "AABB/AABB", BenchmarkShape::AABB, BenchmarkShape::AABB },
+	{ "rotated AABB/AABB", BenchmarkShape::ROTATED_AABB, BenchmarkShape::AABB },
+	{ "polygon/polygon", BenchmarkShape::POLYGON, BenchmarkShape::POLYGON },
+	{ "polygon/circle", BenchmarkShape::POLYGON, BenchmarkShape::CIRCLE },
+};
+
+/*
+* class SeparatingAxisSolver
+* child of CollisionSolver
+*
+* a collision solver that sends every pair to SAT, so the closed-form
+* tests in the dispatch table can be timed against it
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class SeparatingAxisSolver : public CollisionSolver
+{
+public:
+
+	/*
+	* SeparatingAxisSolver()
+	* default constructor - points every entry of the dispatch table at SAT
+	*/
+	SeparatingAxisSolver()
+	{
+		for (int i = 0; i < BOUNDS_TYPE_COUNT; i++)
+		{
+			for (int j = 0; j < BOUNDS_TYPE_COUNT; j++)
+			{
+				pairTests[i][j] = &SeparatingAxisSolver::separatingAxisTest;
+			}
+		}
+	};
+};
+
+//makes a shape about 20 units across somewhere in a 60 unit square, so roughly half the pairs touch
+static Collider* createShape(BenchmarkShape shape)
+{
+	Collider* collider = nullptr;
+
+	switch (shape)
+	{
+	case BenchmarkShape::CIRCLE:
+		collider = new Circle(randomFloat(5.0f, 15.0f));
+		break;
+	case BenchmarkShape::AABB:
+	case BenchmarkShape::ROTATED_AABB:
+	{
+		Vector2 extents{ randomFloat(5.0f, 15.0f), randomFloat(5.0f, 15.0f) };
+		collider = new AABB(extents * -1.0f, extents);
+		break;
+	}
+	case BenchmarkShape::POLYGON:
+	{
+		//a pentagon with its corners pushed in and out
+		std::vector<Vector2> points;
+
+		for (int i = 0; i < 5; i++)
+		{
+			float angle = i * 6.2831853f / 5.0f;
+			float radius = randomFloat(8.0f, 15.0f);
+			points.push_back(Vector2{ cosf(angle) * radius, sinf(angle) * radius });
+		}
+
+		collider = new Polygon(points);
+		collider->transform.rotation = randomFloat(-3.0f, 3.0f);
+		break;
+	}
+	}
+
+	if (shape == BenchmarkShape::ROTATED_AABB)
+	{
+		collider->transform.rotation = randomFloat(0.1f, 1.4f);
+	}
+
+	collider->transform.translation = Vector2{ randomFloat(0.0f, 60.0f), randomFloat(0.0f, 60.0f) };
+	collider->transform.updateGlobalTransform();
+
+	return collider;
+}
+
+//times every test of one type of pair with a solver, returns the time per test in nanoseconds
+static double timeTests(CollisionSolver* solver, std::vector<Collider*>& A, std::vector<Collider*>& B, size_t& hits)
+{
+	//the first test of each shape allocates its cached world geometry, only count the tests after that
+	for (size_t i = 0; i < NARROWPHASE_PAIR_COUNT; i++)
+	{
+		solver->doAdvancedIntersectionTest(A[i], B[i]);
+	}
+
+	solver->resetStats();
+
+	hits = 0;
+	Stopwatch stopwatch;
+
+	for (size_t i = 0; i < NARROWPHASE_TEST_COUNT; i++)
+	{
+		size_t pair = i % NARROWPHASE_PAIR_COUNT;
+
+		if (solver->doAdvancedIntersectionTest(A[pair], B[pair]).intersection)
+		{
+			hits++;
+		}
+	}
+
+	return stopwatch.milliseconds() * 1000000.0 / NARROWPHASE_TEST_COUNT;
+}
+
+//times one type of pair through the solver's dispatch and through SAT alone
+static void timeCase(const NarrowphaseCase& pairCase, SeparatingAxisSolver* separatingAxis)
+{
+	std::vector<Collider*> A(NARROWPHASE_PAIR_COUNT);
+	std::vector<Collider*> B(NARROWPHASE_PAIR_COUNT);
+
+	for (size_t i = 0; i < NARROWPHASE_PAIR_COUNT; i++)
+	{
+		A[i] = createShape(pairCase.A);
+		B[i] = createShape(pairCase.B);
+	}
+
+	size_t hits = 0;
+	size_t separatingAxisHits = 0;
+
+	double dispatched = timeTests(COLL_SOLVER, A, B, hits);
+	double separatingAxisOnly = timeTests(separatingAxis, A, B, separatingAxisHits);
+
+	NarrowphaseStats& stats = COLL_SOLVER->stats;
+
+	//both solvers must agree on which pairs touch
+	printf("%-20s %8.1f ns/test   %8.1f ns/test SAT   %5.2fx   %5.1f%% hit%s   %zu SAT fallbacks   %zu allocations\n",
+		pairCase.name, dispatched, separatingAxisOnly, separatingAxisOnly / dispatched, hits * 100.0 / NARROWPHASE_TEST_COUNT,
+		hits == separatingAxisHits ? "" : " (MISMATCH)", stats.satTests, stats.allocations + separatingAxis->stats.allocations);
+
+	for (size_t i = 0; i < NARROWPHASE_PAIR_COUNT; i++)
+	{
+		delete A[i];
+		delete B[i];
+	}
+}
+
+//times every type of pair with and without the closed-form tests and counts the heap allocations made while testing them
+void benchmarkNarrowphase()
+{
+#ifndef COLLISION_COUNT_ALLOCATIONS
+	printf("allocations aren't counted, define COLLISION_COUNT_ALLOCATIONS\n");
+#endif
+
+	SeparatingAxisSolver separatingAxis;
+
+	for (const NarrowphaseCase& pairCase : narrowphaseCases)
+	{
+		timeCase(pairCase, &separatingAxis);
+	}
+}
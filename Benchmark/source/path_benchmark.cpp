@@ -0,0 +1,77 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <vector>
+
+#include "path.h"
+#include "container.h"
+
+//how many paths are found on every map
+#define PATH_QUERY_COUNT 2000
+
+//times the same queries on one map, walking the tree and then with A*
+static void timePaths(int recursionLevel)
+{
+	//a map as big as the level can split, the game's maps are split twice
+	Container container = Container{};
+	container.maxX = 4095;
+	container.maxY = 4095;
+	container.split(recursionLevel, 0.45f);
+
+	Path path;
+	path.generateNodesRecursive(&container);
+
+	//the same queries for both ways of finding paths
+	std::vector<Node*> begins(PATH_QUERY_COUNT);
+	std::vector<Node*> ends(PATH_QUERY_COUNT);
+
+	for (size_t i = 0; i < PATH_QUERY_COUNT; i++)
+	{
+		begins[i] = path.nodes[rand() % path.nodes.size()];
+		ends[i] = path.nodes[rand() % path.nodes.size()];
+	}
+
+	std::vector<std::vector<Node*>> treePaths(PATH_QUERY_COUNT);
+	size_t hops = 0;
+
+	Stopwatch stopwatch;
+
+	for (size_t i = 0; i < PATH_QUERY_COUNT; i++)
+	{
+		treePaths[i] = path.calculatePath(begins[i], ends[i]);
+		hops += treePaths[i].size();
+	}
+
+	double treeTime = stopwatch.milliseconds();
+
+	//search the same map as if it wasn't a tree
+	path.treeShaped = false;
+	size_t mismatches = 0;
+
+	stopwatch.restart();
+
+	for (size_t i = 0; i < PATH_QUERY_COUNT; i++)
+	{
+		if (path.calculatePath(begins[i], ends[i]) != treePaths[i])
+		{
+			mismatches++;
+		}
+	}
+
+	double searchTime = stopwatch.milliseconds();
+
+	printf("recursion level %2d  %6zu nodes  %6.1f nodes/path   tree %9.2f us/path   A* %9.2f us/path   %5.1fx   %zu different paths\n",
+		recursionLevel, path.nodes.size(), (double)hops / PATH_QUERY_COUNT, treeTime * 1000.0 / PATH_QUERY_COUNT,
+		searchTime * 1000.0 / PATH_QUERY_COUNT, searchTime / treeTime, mismatches);
+}
+
+//times the tree walk and A* on bigger and bigger maps
+void benchmarkPaths()
+{
+	int recursionLevels[] = { 2, 6, 10, 14 };
+
+	for (int recursionLevel : recursionLevels)
+	{
+		timePaths(recursionLevel);
+	}
+}
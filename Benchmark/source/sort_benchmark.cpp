@@ -0,0 +1,134 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "sorter.h"
+
+//small sizes are timed on several different arrays until this many items have been sorted, so their times aren't
+//just noise. sorting the same small array again would let the branch predictor learn it
+#define SORT_ITEMS_PER_TIMING 1000000
+
+//random arrays bigger than this aren't given to insertion sort, it's O(n^2) on them
+#define SORT_INSERTION_LIMIT 10000
+
+typedef std::vector<IndexedItem<float>> SortArray;
+
+//a sort to time, and the most random items it's given
+struct SortCase
+{
+	const char* name;
+	void(*sort)(SortArray&);
+	size_t randomLimit;
+};
+
+static bool lessValue(const IndexedItem<float>& a, const IndexedItem<float>& b)
+{
+	return a.value < b.value;
+}
+
+//a lambda rather than lessValue, so std::sort can inline its comparisons like the templates in sorter.h
+static void standardSort(SortArray& arr)
+{
+	std::sort(arr.begin(), arr.end(), [](const IndexedItem<float>& a, const IndexedItem<float>& b) { return a.value < b.value; });
+}
+
+static void standardStableSort(SortArray& arr)
+{
+	std::stable_sort(arr.begin(), arr.end(), [](const IndexedItem<float>& a, const IndexedItem<float>& b) { return a.value < b.value; });
+}
+
+static void insertionSortAll(SortArray& arr)
+{
+	insertionSort<float>(arr);
+}
+
+const SortCase sortCases[] =
+{
+	{ "std::sort", standardSort, SIZE_MAX },
+	{ "quickSort", quickSort<float>, SIZE_MAX },
+	{ "heapSort", heapSort<float>, SIZE_MAX },
+	{ "shellSort", shellSort<float>, SIZE_MAX },
+	{ "insertionSort", insertionSortAll, SORT_INSERTION_LIMIT },
+	{ "std::stable_sort", standardStableSort, SIZE_MAX },
+	{ "radixSort", radixSort<float>, SIZE_MAX },
+	{ "mergeSort", mergeSort<float>, SIZE_MAX },
+	{ "parallelMergeSort", parallelMergeSort<float>, SIZE_MAX },
+};
+
+//times one sort on copies of the same arrays, and checks the copies come out sorted
+static void timeSort(const SortCase& sortCase, const std::vector<SortArray>& originals, bool random)
+{
+	if (random && originals[0].size() > sortCase.randomLimit)
+	{
+		printf("%-18s %10s\n", sortCase.name, "-");
+		return;
+	}
+
+	double milliseconds = 0.0;
+	bool sorted = true;
+
+	for (const SortArray& original : originals)
+	{
+		SortArray arr = original;
+
+		Stopwatch stopwatch;
+		sortCase.sort(arr);
+		milliseconds += stopwatch.milliseconds();
+
+		sorted = sorted && std::is_sorted(arr.begin(), arr.end(), lessValue);
+	}
+
+	printf("%-18s %10.3f ms%s\n", sortCase.name, milliseconds / originals.size(), sorted ? "" : "   NOT SORTED");
+}
+
+//fills an array with random values, or with sorted values that have had a few neighbours swapped,
+//like the endpoints of a broadphase after a frame of movement
+static void fillArray(SortArray& arr, bool random)
+{
+	for (size_t i = 0; i < arr.size(); i++)
+	{
+		arr[i].value = random ? randomFloat(-10000.0f, 10000.0f) : (float)i;
+		arr[i].index = (int)i;
+	}
+
+	if (!random)
+	{
+		//about one item in a hundred swaps with its neighbour
+		for (size_t i = 0; i + 1 < arr.size(); i++)
+		{
+			if (rand() % 100 == 0)
+			{
+				std::swap(arr[i].value, arr[i + 1].value);
+			}
+		}
+	}
+}
+
+//times every sort on 10^3 to 10^7 random and nearly sorted items
+void benchmarkSorts()
+{
+	size_t caseCount = sizeof(sortCases) / sizeof(sortCases[0]);
+
+	for (size_t count = 1000; count <= 10000000; count *= 10)
+	{
+		for (int random = 1; random >= 0; random--)
+		{
+			std::vector<SortArray> originals(std::max<size_t>(1, SORT_ITEMS_PER_TIMING / count), SortArray(count));
+
+			for (SortArray& original : originals)
+			{
+				fillArray(original, random != 0);
+			}
+
+			printf("%zu items, %s\n", count, random ? "random" : "nearly sorted");
+
+			for (size_t i = 0; i < caseCount; i++)
+			{
+				timeSort(sortCases[i], originals, random != 0);
+			}
+		}
+	}
+}
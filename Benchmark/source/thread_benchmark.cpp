@@ -0,0 +1,90 @@
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <vector>
+
+#include "thread_pool.h"
+
+//how many times work is handed out while the hand-outs are timed
+#define THREAD_JOB_COUNT 10000
+
+//how many indices every piece of work has
+#define THREAD_INDEX_COUNT 4096
+
+//hands out work that marks every index, and checks every index was marked once by a worker the pool has
+static bool checkParallelFor(ThreadPool& pool)
+{
+	std::vector<unsigned int> marks(THREAD_INDEX_COUNT, 0);
+	bool badWorker = false;
+	unsigned int threadCount = pool.getThreadCount();
+
+	pool.parallelFor(THREAD_INDEX_COUNT, 1, [&](size_t start, size_t end, unsigned int worker)
+	{
+		if (worker >= threadCount)
+		{
+			badWorker = true;
+		}
+
+		for (size_t i = start; i < end; i++)
+		{
+			marks[i]++;
+		}
+	});
+
+	for (unsigned int mark : marks)
+	{
+		if (mark != 1)
+		{
+			return false;
+		}
+	}
+
+	return !badWorker;
+}
+
+//times handing out work with more and more threads, then changes the thread count of a pool that has already
+//been used, the threads it starts must wait for new work instead of running the last work again
+void benchmarkThreads()
+{
+	unsigned int threadCounts[] = { 1, 2, 4 };
+
+	for (unsigned int threadCount : threadCounts)
+	{
+		ThreadPool pool;
+		pool.setThreadCount(threadCount);
+
+		std::vector<float> values(THREAD_INDEX_COUNT, 1.0f);
+
+		Stopwatch stopwatch;
+
+		for (int i = 0; i < THREAD_JOB_COUNT; i++)
+		{
+			pool.parallelFor(THREAD_INDEX_COUNT, 256, [&](size_t start, size_t end, unsigned int)
+			{
+				for (size_t j = start; j < end; j++)
+				{
+					values[j] = values[j] * 0.5f + 0.5f;
+				}
+			});
+		}
+
+		printf("%u threads   %8.2f us/parallelFor\n", threadCount, stopwatch.milliseconds() * 1000.0 / THREAD_JOB_COUNT);
+	}
+
+	//grow, shrink and grow again after the pool has run work
+	ThreadPool pool;
+	unsigned int resizes[] = { 4, 3, 1, 6, 2 };
+	bool passed = true;
+
+	for (unsigned int threadCount : resizes)
+	{
+		pool.setThreadCount(threadCount);
+
+		for (int i = 0; i < 100; i++)
+		{
+			passed = checkParallelFor(pool) && passed;
+		}
+	}
+
+	printf("resizing after use: %s\n", passed ? "passed" : "FAILED");
+}
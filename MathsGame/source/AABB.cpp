@@ -10,43 +10,23 @@ AABB::AABB(Vector2 _min, Vector2 _max)
 }
 
 //gets the four projection axes to use with a AABB
-std::vector<Vector2> AABB::getAxes(Collider& other)
+void AABB::getAxes(Collider& other, AxisBuffer& axes)
 {
+	updateWorldGeometry();
 
-	//get the four corner positions with transformations
-	Vector2 topLeft = (Vector3(min.x, min.y, 1) * transform.globalTransform).GetXY();
-	Vector2 topRight = (Vector3(max.x, min.y, 1) * transform.globalTransform).GetXY();
-	Vector2 bottomLeft = (Vector3(min.x, max.y, 1) * transform.globalTransform).GetXY();
-	Vector2 bottomRight = (Vector3(max.x, max.y, 1) * transform.globalTransform).GetXY();
-	
-	std::vector<Vector2> axes;
-
-	//add all relative vectors on the boundary of the AABB
-	axes.push_back((topRight - topLeft).normalised());
-	axes.push_back((bottomRight - topRight).normalised());
-	axes.push_back((bottomLeft - bottomRight).normalised());
-	axes.push_back((topLeft - bottomLeft).normalised());
-
-	return axes;
+	for (size_t i = 0; i < 4; i++)
+	{
+		axes.push(worldAxes[i]);
+	}
 }
 
 //get the smallest and largest dot products of the AABB to the axis
 Range AABB::project(Vector2 axis)
 {
+	updateWorldGeometry();
 
-	//get the four corner positions with transformations
-	Vector2 topLeft = (Vector3(min.x, min.y, 1) * transform.globalTransform).GetXY();
-	Vector2 topRight = (Vector3(max.x, min.y, 1) * transform.globalTransform).GetXY();
-	Vector2 bottomLeft = (Vector3(min.x, max.y, 1) * transform.globalTransform).GetXY();
-	Vector2 bottomRight = (Vector3(max.x, max.y, 1) * transform.globalTransform).GetXY();
-
-	std::vector<Vector2> axes;
-
-	//add all corner vectors of the AABB
-	axes.push_back(topLeft);
-	axes.push_back(topRight);
-	axes.push_back(bottomLeft);
-	axes.push_back(bottomRight);
+	//the four corner positions with transformations
+	std::vector<Vector2>& axes = worldPoints;
 	
 	Vector2 axisNorm = axis.normalised();
 
@@ -78,24 +58,16 @@ std::vector<Vector2> AABB::getPoints()
 
 std::vector<Vector2> AABB::support(Vector2 normal)
 {
-	//get the global transformation matrix without translation
-	Matrix3 globalInvTrans = transform.globalTransform;
-	globalInvTrans[2][0] = 0;
-	globalInvTrans[2][1] = 0;
+	updateWorldGeometry();
 
-	//get the four corner positions with transformations
-	Vector2 topLeft = (Vector3(min.x, min.y, 1) * globalInvTrans).GetXY();
-	Vector2 topRight = (Vector3(max.x, min.y, 1) * globalInvTrans).GetXY();
-	Vector2 bottomLeft = (Vector3(min.x, max.y, 1) * globalInvTrans).GetXY();
-	Vector2 bottomRight = (Vector3(max.x, max.y, 1) * globalInvTrans).GetXY();
+	//get the four corner positions with the transformation minus translation
+	Vector2 translation = transform.globalTransform.getTranslation();
+	Vector2 points[4];
 
-	std::vector<Vector2> points;
-
-	//add all corner vectors of the AABB
-	points.push_back(topLeft);
-	points.push_back(topRight);
-	points.push_back(bottomLeft);
-	points.push_back(bottomRight);
+	for (size_t i = 0; i < 4; i++)
+	{
+		points[i] = worldPoints[i] - translation;
+	}
 
 	std::vector<Vector2> bestList;
 	float bestDot = -1.1f; //this is not possible with normal dots, will get assigned over in the future
@@ -143,28 +115,38 @@ float AABB::momentOfInertia(float mass)
 
 }
 
-//create an aabb that encapsulates the shape
-void AABB::generateHull()
+//transform the corners, side directions and hull into world space
+void AABB::calculateWorldGeometry()
 {
-	if (hull != nullptr)
-	{
-		delete hull;
-	}
+	//get the four corner positions with transformations (top left, top right, bottom left, bottom right)
+	worldPoints.resize(4);
+	worldPoints[0] = Vector2{ min.x, min.y };
+	worldPoints[1] = Vector2{ max.x, min.y };
+	worldPoints[2] = Vector2{ min.x, max.y };
+	worldPoints[3] = Vector2{ max.x, max.y };
 
-	Range xRange = project(Vector2{ 1,0 });
-	Range yRange = project(Vector2{ 0,1 });
+	transform.globalTransform.transformPoints(worldPoints.data(), worldPoints.data(), 4);
 
-	Vector2 min = Vector2{ xRange.min, yRange.min };
-	Vector2 max = Vector2{ xRange.max, yRange.max };
+	Vector2 topLeft = worldPoints[0];
+	Vector2 topRight = worldPoints[1];
+	Vector2 bottomLeft = worldPoints[2];
+	Vector2 bottomRight = worldPoints[3];
+
+	//add all relative vectors on the boundary of the AABB
+	worldAxes.resize(4);
+	worldAxes[0] = (topRight - topLeft).normalised();
+	worldAxes[1] = (bottomRight - topRight).normalised();
+	worldAxes[2] = (bottomLeft - bottomRight).normalised();
+	worldAxes[3] = (topLeft - bottomLeft).normalised();
 
-	hull = new AABB{min, max};
+	fitHullToPoints();
 }
 
 void AABB::render(Application2D* app)
 {
 
 	//get the position and rotation from the matrix
-	Vector2 position = (transform.globalTransform * Vector3{ 0, 0, 1 }).GetXY();
+	Vector2 position = transform.globalTransform.transformPoint(Vector2{ 0, 0 });
 
 	Transform extraction = extractMatrix(transform.globalTransform);
 
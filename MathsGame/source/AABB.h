@@ -45,9 +45,10 @@ public:
 	* calculates 4 axes to use with the Seperating Axis Theorem
 	*
 	* @param Collider& - the other shape in the collision test, this is necessary for circles
-	* @returns std::vector<Vector2> - a list of directional vectors to test
+	* @param AxisBuffer& - the list to add the axes to
+	* @returns void
 	*/
-	std::vector<Vector2> getAxes(Collider&) override;
+	void getAxes(Collider&, AxisBuffer&) override;
 
 	/*
 	* project
@@ -93,13 +94,13 @@ public:
 	float momentOfInertia(float mass) override;
 
 	/*
-	* generateHull
-	* overrides Collider's generateHull()
+	* calculateWorldGeometry
+	* overrides Collider's calculateWorldGeometry()
 	*
-	* calculates the minimum AABB that contains the shape
+	* transforms the corners into world space and sizes the hull around it
 	* @returns void
 	*/
-	void generateHull() override;
+	void calculateWorldGeometry() override;
 
 	/*
 	* render
@@ -109,8 +109,15 @@ bool Application2D::startup()
 	//resize the generated pathfinding map to fit the world
 	path.scale(96.0f);
 
+	pathService.path = &path;
+	pathService.workers = &world.narrowphaseThreads;
+	flowField.path = &path;
+
 	size_t wallsSize = walls.size();
 
+	//the walls never move, they go in the partition's static layer
+	std::vector<BaseEntity*> statics;
+
 	//iterate though the rows
 	for (size_t i = 0; i < wallsSize; i++)
 	{
@@ -121,11 +128,13 @@ bool Application2D::startup()
 		{
 			if (walls[i][j] != nullptr)
 			{
-				world.registerCollider(walls[i][j], true);
+				statics.push_back(walls[i][j]);
 			}
 		}
 	}
 
+	world.buildStaticLayer(statics);
+
 	PlayerEntity* player = FACTORY->createPlayer(&path);
 
 	player->closestNode = player->getClosestNode(&world, &path);
@@ -229,7 +238,16 @@ void Application2D::update(float deltaTime)
 	//get the input singleton
 	aie::Input* input = aie::Input::getInstance();
 
-	world.updateAll(deltaTime, this);
+	//the world steps at a fixed rate, so a key press has to be kept until a step uses it
+	if (input->wasKeyPressed(aie::INPUT_KEY_LEFT_SHIFT))
+	{
+		interactPressed = true;
+	}
+
+	//search for the paths asked for last frame, the enemies collect them during the steps
+	pathService.update();
+
+	world.advance(deltaTime, this);
 
 	//quit if the player presses escape
 	if (input->wasKeyPressed(aie::INPUT_KEY_ESCAPE))
@@ -244,11 +262,8 @@ void Application2D::draw()
 	//clear the screen back to the background colour
 	clearScreen();
 
-	//get the global matrix of the player
-	Matrix3 transMatrix = world.entities[playerIndex].entity->collider->transform.globalTransform;
-
 	//set the camera's position to the player
-	m_camera = Vector2{ transMatrix[2][0], transMatrix[2][1] };
+	m_camera = world.renderTransform(world.entities[playerIndex].entity->collider->transform).getTranslation();
 	m_camera += Vector2{ (float)getWindowWidth(), (float)getWindowHeight() } * -0.5f;
 
 	//set the renderer's camera position to match the camera
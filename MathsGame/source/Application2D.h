@@ -8,6 +8,8 @@
 
 #include "partition.h"
 #include "path.h"
+#include "path_service.h"
+#include "flow_field.h"
 
 /*
 * class Application2D
@@ -121,11 +123,21 @@ public:
 	//index in the entities array that refers to the player
 	int playerIndex = 0;
 
+	//answers the enemies' path requests in batches, declared before the world
+	//so it's still there when the world deletes the enemies waiting on it
+	PathService pathService;
+
 	//the world stored as a static grid 
 	SpatialPartition world;
 	Path path;
 
+	//routes to the player's closest node, shared by every enemy chasing the player
+	FlowField flowField;
+
 	//position of the camera
 	Vector2 m_camera;
 
+	//set when the interact key is pressed, cleared by the fixed step that uses it
+	bool interactPressed = false;
+
 };
\ No newline at end of file
@@ -0,0 +1,421 @@
+#include "aabb_tree.h"
+
+//perimeter of a box, used as the cost of a branch when choosing where to insert
+static float perimeter(Vector2 min, Vector2 max)
+{
+	return 2.0f * ((max.x - min.x) + (max.y - min.y));
+}
+
+//smallest box containing two boxes
+static void combine(Vector2 aMin, Vector2 aMax, Vector2 bMin, Vector2 bMax, Vector2& min, Vector2& max)
+{
+	min.x = aMin.x < bMin.x ? aMin.x : bMin.x;
+	min.y = aMin.y < bMin.y ? aMin.y : bMin.y;
+	max.x = aMax.x > bMax.x ? aMax.x : bMax.x;
+	max.y = aMax.y > bMax.y ? aMax.y : bMax.y;
+}
+
+//add a fattened leaf
+int AABBTree::createProxy(BaseEntity* entity, Vector2 min, Vector2 max)
+{
+	int leaf = allocateNode();
+
+	Vector2 fat = Vector2{ margin, margin };
+
+	nodes[leaf].min = min - fat;
+	nodes[leaf].max = max + fat;
+	nodes[leaf].entity = entity;
+	nodes[leaf].height = 0;
+
+	insertLeaf(leaf);
+
+	proxyCount++;
+
+	return leaf;
+}
+
+//remove a leaf and give its node back
+void AABBTree::destroyProxy(int proxy)
+{
+	removeLeaf(proxy);
+	freeNode(proxy);
+
+	proxyCount--;
+}
+
+//only reinsert the leaf if the hull escaped its fattened box
+bool AABBTree::moveProxy(int proxy, Vector2 min, Vector2 max)
+{
+	AABBTreeNode& leaf = nodes[proxy];
+
+	if (leaf.min.x <= min.x && leaf.min.y <= min.y && max.x <= leaf.max.x && max.y <= leaf.max.y)
+	{
+		return false;
+	}
+
+	removeLeaf(proxy);
+
+	Vector2 fat = Vector2{ margin, margin };
+
+	nodes[proxy].min = min - fat;
+	nodes[proxy].max = max + fat;
+
+	insertLeaf(proxy);
+
+	return true;
+}
+
+//descend into every branch that overlaps the area
+void AABBTree::query(Vector2 min, Vector2 max, Collider* excluded, std::vector<BaseEntity*>& results)
+{
+	if (root == AABB_TREE_NULL)
+	{
+		return;
+	}
+
+	queryStack.clear();
+	queryStack.push_back(root);
+
+	while (!queryStack.empty())
+	{
+		int index = queryStack.back();
+		queryStack.pop_back();
+
+		const AABBTreeNode& node = nodes[index];
+
+		//the boxes don't overlap, nothing below this node can be in the area
+		if (node.min.x > max.x || min.x > node.max.x || node.min.y > max.y || min.y > node.max.y)
+		{
+			continue;
+		}
+
+		if (node.isLeaf())
+		{
+			//don't make a shape test collisions against itself
+			if (node.entity->collider != excluded)
+			{
+				results.push_back(node.entity);
+			}
+		}
+		else
+		{
+			queryStack.push_back(node.left);
+			queryStack.push_back(node.right);
+		}
+	}
+}
+
+//height of the root
+int AABBTree::getHeight()
+{
+	return root == AABB_TREE_NULL ? -1 : nodes[root].height;
+}
+
+//reuse a free node or grow the array
+int AABBTree::allocateNode()
+{
+	if (freeList == AABB_TREE_NULL)
+	{
+		nodes.push_back(AABBTreeNode{});
+		return (int)nodes.size() - 1;
+	}
+
+	int node = freeList;
+	freeList = nodes[node].parent;
+
+	nodes[node] = AABBTreeNode{};
+
+	return node;
+}
+
+//push the node onto the free list
+void AABBTree::freeNode(int node)
+{
+	nodes[node] = AABBTreeNode{};
+	nodes[node].parent = freeList;
+
+	freeList = node;
+}
+
+//walk down choosing the child that grows the least, then join the leaf to the node found
+void AABBTree::insertLeaf(int leaf)
+{
+	if (root == AABB_TREE_NULL)
+	{
+		root = leaf;
+		nodes[root].parent = AABB_TREE_NULL;
+		return;
+	}
+
+	Vector2 leafMin = nodes[leaf].min;
+	Vector2 leafMax = nodes[leaf].max;
+
+	int index = root;
+
+	while (!nodes[index].isLeaf())
+	{
+		const AABBTreeNode& node = nodes[index];
+
+		Vector2 combinedMin;
+		Vector2 combinedMax;
+		combine(node.min, node.max, leafMin, leafMax, combinedMin, combinedMax);
+
+		float area = perimeter(node.min, node.max);
+		float combinedArea = perimeter(combinedMin, combinedMax);
+
+		//cost of making a new parent for this node and the leaf
+		float cost = 2.0f * combinedArea;
+
+		//minimum cost of pushing the leaf further down the tree
+		float inheritanceCost = 2.0f * (combinedArea - area);
+
+		float childCost[2];
+		int children[2] = { node.left, node.right };
+
+		for (int i = 0; i < 2; i++)
+		{
+			const AABBTreeNode& child = nodes[children[i]];
+
+			Vector2 childMin;
+			Vector2 childMax;
+			combine(child.min, child.max, leafMin, leafMax, childMin, childMax);
+
+			//a leaf child gets a new parent, a branch child only grows
+			childCost[i] = perimeter(childMin, childMax) + inheritanceCost;
+
+			if (!child.isLeaf())
+			{
+				childCost[i] -= perimeter(child.min, child.max);
+			}
+		}
+
+		//stop descending if this node is the cheapest sibling
+		if (cost < childCost[0] && cost < childCost[1])
+		{
+			break;
+		}
+
+		index = childCost[0] < childCost[1] ? children[0] : children[1];
+	}
+
+	int sibling = index;
+
+	//create a new parent for the sibling and the leaf
+	int newParent = allocateNode();
+	int oldParent = nodes[sibling].parent;
+
+	nodes[newParent].parent = oldParent;
+	nodes[newParent].height = nodes[sibling].height + 1;
+	combine(nodes[sibling].min, nodes[sibling].max, leafMin, leafMax, nodes[newParent].min, nodes[newParent].max);
+
+	nodes[newParent].left = sibling;
+	nodes[newParent].right = leaf;
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	if (oldParent == AABB_TREE_NULL)
+	{
+		//the sibling was the root
+		root = newParent;
+	}
+	else if (nodes[oldParent].left == sibling)
+	{
+		nodes[oldParent].left = newParent;
+	}
+	else
+	{
+		nodes[oldParent].right = newParent;
+	}
+
+	refitAncestors(nodes[leaf].parent);
+}
+
+//replace the leaf's parent with the leaf's sibling
+void AABBTree::removeLeaf(int leaf)
+{
+	if (leaf == root)
+	{
+		root = AABB_TREE_NULL;
+		return;
+	}
+
+	int parent = nodes[leaf].parent;
+	int grandParent = nodes[parent].parent;
+	int sibling = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+
+	freeNode(parent);
+
+	if (grandParent == AABB_TREE_NULL)
+	{
+		root = sibling;
+		nodes[sibling].parent = AABB_TREE_NULL;
+		return;
+	}
+
+	//connect the sibling to the grandparent
+	if (nodes[grandParent].left == parent)
+	{
+		nodes[grandParent].left = sibling;
+	}
+	else
+	{
+		nodes[grandParent].right = sibling;
+	}
+
+	nodes[sibling].parent = grandParent;
+
+	refitAncestors(grandParent);
+}
+
+//fix boxes and heights from a branch up to the root
+void AABBTree::refitAncestors(int node)
+{
+	while (node != AABB_TREE_NULL)
+	{
+		node = balance(node);
+
+		AABBTreeNode& branch = nodes[node];
+		const AABBTreeNode& left = nodes[branch.left];
+		const AABBTreeNode& right = nodes[branch.right];
+
+		branch.height = 1 + (left.height > right.height ? left.height : right.height);
+		combine(left.min, left.max, right.min, right.max, branch.min, branch.max);
+
+		node = branch.parent;
+	}
+}
+
+//rotate the taller child up into the branch's place
+int AABBTree::balance(int iA)
+{
+	AABBTreeNode& A = nodes[iA];
+
+	if (A.isLeaf() || A.height < 2)
+	{
+		return iA;
+	}
+
+	int iB = A.left;
+	int iC = A.right;
+
+	AABBTreeNode& B = nodes[iB];
+	AABBTreeNode& C = nodes[iC];
+
+	int difference = C.height - B.height;
+
+	//the right side is too tall, rotate C up
+	if (difference > 1)
+	{
+		int iF = C.left;
+		int iG = C.right;
+
+		AABBTreeNode& F = nodes[iF];
+		AABBTreeNode& G = nodes[iG];
+
+		//swap A and C
+		C.left = iA;
+		C.parent = A.parent;
+		A.parent = iC;
+
+		//A's old parent should point to C
+		if (C.parent == AABB_TREE_NULL)
+		{
+			root = iC;
+		}
+		else if (nodes[C.parent].left == iA)
+		{
+			nodes[C.parent].left = iC;
+		}
+		else
+		{
+			nodes[C.parent].right = iC;
+		}
+
+		//the taller of C's children stays with C, the other moves to A
+		if (F.height > G.height)
+		{
+			C.right = iF;
+			A.right = iG;
+			G.parent = iA;
+
+			combine(B.min, B.max, G.min, G.max, A.min, A.max);
+			combine(A.min, A.max, F.min, F.max, C.min, C.max);
+
+			A.height = 1 + (B.height > G.height ? B.height : G.height);
+			C.height = 1 + (A.height > F.height ? A.height : F.height);
+		}
+		else
+		{
+			C.right = iG;
+			A.right = iF;
+			F.parent = iA;
+
+			combine(B.min, B.max, F.min, F.max, A.min, A.max);
+			combine(A.min, A.max, G.min, G.max, C.min, C.max);
+
+			A.height = 1 + (B.height > F.height ? B.height : F.height);
+			C.height = 1 + (A.height > G.height ? A.height : G.height);
+		}
+
+		return iC;
+	}
+
+	//the left side is too tall, rotate B up
+	if (difference < -1)
+	{
+		int iD = B.left;
+		int iE = B.right;
+
+		AABBTreeNode& D = nodes[iD];
+		AABBTreeNode& E = nodes[iE];
+
+		//swap A and B
+		B.left = iA;
+		B.parent = A.parent;
+		A.parent = iB;
+
+		//A's old parent should point to B
+		if (B.parent == AABB_TREE_NULL)
+		{
+			root = iB;
+		}
+		else if (nodes[B.parent].left == iA)
+		{
+			nodes[B.parent].left = iB;
+		}
+		else
+		{
+			nodes[B.parent].right = iB;
+		}
+
+		//the taller of B's children stays with B, the other moves to A
+		if (D.height > E.height)
+		{
+			B.right = iD;
+			A.left = iE;
+			E.parent = iA;
+
+			combine(C.min, C.max, E.min, E.max, A.min, A.max);
+			combine(A.min, A.max, D.min, D.max, B.min, B.max);
+
+			A.height = 1 + (C.height > E.height ? C.height : E.height);
+			B.height = 1 + (A.height > D.height ? A.height : D.height);
+		}
+		else
+		{
+			B.right = iE;
+			A.left = iD;
+			D.parent = iA;
+
+			combine(C.min, C.max, D.min, D.max, A.min, A.max);
+			combine(A.min, A.max, E.min, E.max, B.min, B.max);
+
+			A.height = 1 + (C.height > D.height ? C.height : D.height);
+			B.height = 1 + (A.height > E.height ? A.height : E.height);
+		}
+
+		return iB;
+	}
+
+	return iA;
+}
@@ -0,0 +1,208 @@
+#pragma once
+#include <vector>
+#include "base_entity.h"
+
+//index used by the tree for "no node"
+#define AABB_TREE_NULL -1
+
+/*
+* struct AABBTreeNode
+*
+* a node in the AABBTree, leaves hold an entity and branches hold two children.
+* the box of a leaf is the entity's hull grown by the tree's margin,
+* the box of a branch is the smallest box containing both of its children
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct AABBTreeNode
+{
+	Vector2 min; //top-left corner of the box
+	Vector2 max; //bottom-right corner of the box
+
+	BaseEntity* entity = nullptr; //the entity of a leaf, nullptr for branches
+
+	int parent = AABB_TREE_NULL; //index of the parent, or the next free node when the node is not in use
+	int left = AABB_TREE_NULL; //index of the first child
+	int right = AABB_TREE_NULL; //index of the second child
+
+	int height = -1; //0 for leaves, -1 for nodes that are not in use
+
+	/*
+	* isLeaf
+	*
+	* checks if the node is a leaf
+	*
+	* @returns bool - true if the node has no children
+	*/
+	bool isLeaf() const { return left == AABB_TREE_NULL; };
+};
+
+/*
+* class AABBTree
+*
+* a dynamic bounding volume tree, every entity is a leaf and every branch's box
+* contains both of its children. a search only descends into branches whose
+* box overlaps the area being searched, so it has no fixed bounds or size limit.
+*
+* leaf boxes are made bigger than the entity by the margin, an entity that moves
+* inside its leaf box doesn't change the tree at all. when it leaves the box its
+* leaf is taken out and inserted again, the boxes above it are refit and rotated
+* to keep the tree balanced
+*
+* nodes are stored in one array and reused through a free list
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class AABBTree
+{
+public:
+
+	float margin = 16.0f; //how much bigger a leaf box is than the entity on each side
+
+	/*
+	* AABBTree()
+	* default constructor
+	*/
+	AABBTree() {};
+
+	/*
+	* ~AABBTree()
+	* default destructor, the tree doesn't own the entities
+	*/
+	~AABBTree() {};
+
+	/*
+	* createProxy
+	*
+	* adds a leaf for an entity to the tree
+	*
+	* @param BaseEntity* entity - the entity the leaf represents
+	* @param Vector2 min - top-left corner of the entity's hull
+	* @param Vector2 max - bottom-right corner of the entity's hull
+	* @returns int - the index of the leaf, used to move or destroy it
+	*/
+	int createProxy(BaseEntity* entity, Vector2 min, Vector2 max);
+
+	/*
+	* destroyProxy
+	*
+	* removes a leaf from the tree
+	*
+	* @param int proxy - the index returned by createProxy
+	* @returns void
+	*/
+	void destroyProxy(int proxy);
+
+	/*
+	* moveProxy
+	*
+	* updates a leaf after its entity moved, the tree is only changed
+	* if the hull is no longer inside the leaf's box
+	*
+	* @param int proxy - the index returned by createProxy
+	* @param Vector2 min - top-left corner of the entity's new hull
+	* @param Vector2 max - bottom-right corner of the entity's new hull
+	* @returns bool - true if the leaf had to be inserted again
+	*/
+	bool moveProxy(int proxy, Vector2 min, Vector2 max);
+
+	/*
+	* query
+	*
+	* adds every entity whose leaf box overlaps an area to a list
+	*
+	* @param Vector2 min - top-left corner of the area
+	* @param Vector2 max - bottom-right corner of the area
+	* @param Collider* excluded - the collider doing the search, it is left out of the list
+	* @param std::vector<BaseEntity*>& results - the list to add to
+	* @returns void
+	*/
+	void query(Vector2 min, Vector2 max, Collider* excluded, std::vector<BaseEntity*>& results);
+
+	/*
+	* getHeight
+	*
+	* gets the number of levels in the tree, a balanced tree of n leaves has about log2(n)
+	*
+	* @returns int - the height of the root, -1 if the tree is empty
+	*/
+	int getHeight();
+
+	/*
+	* size
+	*
+	* gets the number of leaves in the tree
+	*
+	* @returns size_t - the number of entities in the tree
+	*/
+	size_t size() { return proxyCount; };
+
+protected:
+
+	std::vector<AABBTreeNode> nodes; //every node, including the unused ones
+	int root = AABB_TREE_NULL; //index of the top node
+	int freeList = AABB_TREE_NULL; //index of the first unused node
+	size_t proxyCount = 0; //number of leaves
+
+	std::vector<int> queryStack; //branches still to visit during a query, kept so its memory is reused
+
+	/*
+	* allocateNode
+	*
+	* takes a node from the free list, growing the array if there are none left.
+	* references into nodes are not safe across this call
+	*
+	* @returns int - index of the node
+	*/
+	int allocateNode();
+
+	/*
+	* freeNode
+	*
+	* puts a node back on the free list
+	*
+	* @param int node - index of the node
+	* @returns void
+	*/
+	void freeNode(int node);
+
+	/*
+	* insertLeaf
+	*
+	* finds the cheapest sibling for a leaf, joins them under a new branch and refits the boxes above it
+	*
+	* @param int leaf - index of the leaf
+	* @returns void
+	*/
+	void insertLeaf(int leaf);
+
+	/*
+	* removeLeaf
+	*
+	* takes a leaf out of the tree, its sibling replaces their parent
+	*
+	* @param int leaf - index of the leaf
+	* @returns void
+	*/
+	void removeLeaf(int leaf);
+
+	/*
+	* refitAncestors
+	*
+	* walks up from a branch to the root, balancing each branch and fixing its box and height
+	*
+	* @param int node - index of the first branch to fix
+	* @returns void
+	*/
+	void refitAncestors(int node);
+
+	/*
+	* balance
+	*
+	* rotates a branch if one side is more than one level taller than the other
+	*
+	* @param int node - index of the branch
+	* @returns int - index of the node now in the branch's place
+	*/
+	int balance(int node);
+};
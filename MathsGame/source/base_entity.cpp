@@ -63,10 +63,9 @@ void BaseEntity::render(Application2D* appPtr)
 {
 	//the rotation occurs from the top-left corner
 	//use another matrix to force entities to rotate from the centre
-	Matrix3 correction = Matrix3{};
-	correction.identity();
+	Affine2 correction = Affine2{};
 	correction[2][0] = baseTexture->getWidth() / -2.0f + centreOffset.x;
 	correction[2][1] = baseTexture->getHeight() / -2.0f + centreOffset.y;
 
-	appPtr->m_2dRenderer->drawSpriteTransformed3x3(baseTexture, collider->transform.globalTransform * correction, 0.0f, 0.0f, -1, 0.0f, 0.0f);
+	appPtr->m_2dRenderer->drawSpriteTransformed3x3(baseTexture, Matrix3(appPtr->world.renderTransform(collider->transform) * correction), 0.0f, 0.0f, -1, 0.0f, 0.0f);
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 #include "collider.h"
 #include "point.h"
 #include "line.h"
@@ -22,6 +23,80 @@ enum class EntityType
 	MOUNT,
 };
 
+/*
+* struct index2D
+*
+* index pair for a 2D array, i indexes the first dimension, j indexes the second dimension
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct index2D
+{
+	int i;
+	int j;
+};
+
+//forward declaration
+class BaseEntity;
+
+/*
+* struct EntityPair
+*
+* an unordered pair of entities, the lower address is always stored in A
+* so that A-B and B-A are the same pair
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct EntityPair
+{
+	BaseEntity* A;
+	BaseEntity* B;
+
+	/*
+	* EntityPair()
+	* constructor - orders the two entities
+	*
+	* @param BaseEntity* first - one of the entities
+	* @param BaseEntity* second - the other entity
+	*/
+	EntityPair(BaseEntity* first, BaseEntity* second)
+	{
+		bool ordered = std::less<BaseEntity*>()(first, second);
+		A = ordered ? first : second;
+		B = ordered ? second : first;
+	}
+
+	/*
+	* operator==
+	* checks if two pairs hold the same entities
+	*
+	* @param const EntityPair& other - the pair to compare with
+	* @returns bool - true if the pairs match
+	*/
+	bool operator==(const EntityPair& other) const
+	{
+		return A == other.A && B == other.B;
+	}
+};
+
+/*
+* struct EntityPairHash
+*
+* hash function for storing EntityPairs in an unordered_set
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct EntityPairHash
+{
+	size_t operator()(const EntityPair& pair) const
+	{
+		size_t first = std::hash<BaseEntity*>()(pair.A);
+		size_t second = std::hash<BaseEntity*>()(pair.B);
+
+		return first ^ (second + 0x9e3779b9 + (first << 6) + (first >> 2));
+	}
+};
+
 /*
 * class BaseEntity
 *
@@ -43,6 +118,7 @@ public:
 	bool colliding = true; //flag that indicates if the shape will affect other shapes
 	bool awake = true; //flag that indicates if the shape recieves update calls
 	bool reactive = true; //flag that indicates that the shape will react to collisions physically
+	bool bullet = false; //flag for fast entities, their movement is swept against the static layer so they can't pass through it
 
 	float mass = 1; //a mass of 0 means an infinite mass
 	float invMass = 1; //inverse mass is useful for physics calaculations
@@ -58,6 +134,24 @@ public:
 
 	aie::Texture * baseTexture = nullptr; //texture used to draw the entity
 
+	//the block of partition nodes the entity is registered in, kept by SpatialPartition
+	//-----------------------------------------------------------
+	bool partitioned = false; //false if the entity isn't in any node
+	bool staticLayer = false; //true if the block is in the static layer instead of the dynamic nodes
+	index2D nodeStart = index2D{}; //first node of the block
+	index2D nodeEnd = index2D{}; //last node of the block
+	int treeProxy = -1; //the entity's leaf in the partition's AABBTree, -1 if it isn't in the tree
+	int sweepProxy = -1; //the entity's proxy in the partition's SweepAndPrune, -1 if it isn't in the sweep
+	//-----------------------------------------------------------
+
+	//sleeping, kept by SpatialPartition
+	//-----------------------------------------------------------
+	bool sleeping = false; //true once the entity's island has rested long enough, it isn't moved until it is touched or given a velocity
+	float restTime = 0.0f; //how long the entity has moved slower than the partition's sleep thresholds
+	int sleepIsland = -1; //the island the entity fell asleep with, -1 while it is awake
+	int islandIndex = -1; //the entity's position in the partition's entities while islands are built
+	//-----------------------------------------------------------
+
 	/*
 	* BaseEntity()
 	* constructor - assigns the inverse mass
@@ -74,9 +168,10 @@ public:
 
 	/*
 	* ~BaseEntity()
-	* destructor - deletes the collider
+	* destructor - deletes the collider, virtual so the partition deleting
+	* entities through BaseEntity* runs the child class destructors too
 	*/
-	~BaseEntity() { delete collider; };
+	virtual ~BaseEntity() { delete collider; };
 	
 	/*
 	* calculateMass
@@ -11,24 +11,26 @@ Circle::Circle(float _radius)
 }
 
 //gets the projection axis to use with a circle
-std::vector<Vector2> Circle::getAxes(Collider& other)
+void Circle::getAxes(Collider& other, AxisBuffer& axes)
 {
+	updateWorldGeometry();
+	other.updateWorldGeometry();
 
 	//get the positions with transformations
-	Vector2 position = (Vector3{ 0,0,1 } * transform.globalTransform).GetXY();
+	Vector2 position = worldPoints[0];
 
 	Vector2 closestAxis = Vector2{};
 	float closestDistance = std::numeric_limits<float>().max();
 
-	std::vector<Vector2> points = other.getPoints();
+	//the other shape's points are already in world space
+	std::vector<Vector2>& points = other.worldPoints;
 
  	size_t size = points.size();
 
 	//get the closest point to the centre of the circle 
 	for (size_t i = 0; i < size; i++)
 	{
-		Vector2 pointTra = (Vector3{ points[i].x, points[i].y, 1 } * other.transform.globalTransform).GetXY();
-		Vector2 axis = (pointTra - position);
+		Vector2 axis = (points[i] - position);
 		float sqrMag = axis.sqrMagnitude();
 
 		if (sqrMag < closestDistance)
@@ -39,15 +41,17 @@ std::vector<Vector2> Circle::getAxes(Collider& other)
 		}
 	}
 	
-	return std::vector<Vector2>{closestAxis};
+	axes.push(closestAxis);
 }
 
 //get the smallest and largest dot products of the circle to the axis
 Range Circle::project(Vector2 axis)
 {
 
+	updateWorldGeometry();
+
 	//get the positions with transformations
-	Vector2 position = (Vector3{ 0,0,1 } * transform.globalTransform).GetXY();
+	Vector2 position = worldPoints[0];
 	Vector2 axisNorm = axis.normalised();
 	
 	//get the projection positions
@@ -84,30 +88,27 @@ float Circle::momentOfInertia(float mass)
 	return mass * radius * radius;
 }
 
-//create an aabb
-void Circle::generateHull()
+//transform the centre and hull into world space
+void Circle::calculateWorldGeometry()
 {
-	if (hull != nullptr)
-	{
-		delete hull;
-	}
-
-	Range xRange = project(Vector2{ 1,0 });
-	Range yRange = project(Vector2{ 0,1 });
+	worldPoints.resize(1);
+	worldPoints[0] = transform.globalTransform.getTranslation();
 
-	Vector2 min = Vector2{ xRange.min, yRange.min };
-	Vector2 max = Vector2{ xRange.max, yRange.max };
+	//the axes of a circle depend on the other shape, see getAxes
+	worldAxes.clear();
 
-	hull = new AABB{ min, max };
+	Vector2 extents = Vector2{ radius, radius };
+	setHull(worldPoints[0] - extents, worldPoints[0] + extents);
 }
 
 //render the circle
 void Circle::render(Application2D* app)
 {
-	Vector2 position = (transform.globalTransform * Vector3{ 0,0, 1 }).GetXY();
+	Vector2 position = transform.globalTransform.transformPoint(Vector2{ 0, 0 });
 
 	app->m_2dRenderer->drawCircle(position.x, position.y, radius, 0.0f);
 
 	app->m_2dRenderer->setRenderColour(1, 1, 1);
-	app->m_2dRenderer->drawLine(position.x, position.y, (transform.globalTransform * Vector3{ 0, radius, 1 }).x, (transform.globalTransform * Vector3{ 0, radius , 1 }).y);
+	Vector2 edge = transform.globalTransform.transformPoint(Vector2{ 0, radius });
+	app->m_2dRenderer->drawLine(position.x, position.y, edge.x, edge.y);
 }
@@ -43,9 +43,10 @@ public:
 	* calculates the axis to test with a Circle
 	*
 	* @param Collider& - the other shape in the collision test, this is necessary for circles
-	* @returns std::vector<Vector2> - pairs of vectors that stored in a single list, these pairs form the plane to test
+	* @param AxisBuffer& - the list to add the axes to
+	* @returns void
 	*/
-	std::vector<Vector2> getAxes(Collider&) override;
+	void getAxes(Collider&, AxisBuffer&) override;
 
 	/*
 	* project
@@ -91,13 +92,13 @@ public:
 	float momentOfInertia(float mass) override;
 
 	/*
-	* generateHull
-	* overrides Collider's generateHull()
+	* calculateWorldGeometry
+	* overrides Collider's calculateWorldGeometry()
 	*
-	* calculates the minimum AABB that contains the shape
+	* transforms the centre into world space and sizes the hull around it
 	* @returns void
 	*/
-	void generateHull() override;
+	void calculateWorldGeometry() override;
 
 	/*
 	* render
@@ -6,3 +6,64 @@ Collider::~Collider()
 {
 	delete hull;
 }
+
+//the hull is part of the cached geometry
+void Collider::generateHull()
+{
+	updateWorldGeometry();
+}
+
+//rebuilds the cached world geometry only if the transform changed since it was built
+void Collider::updateWorldGeometry()
+{
+	if (geometryValid && geometryVersion == transform.version)
+	{
+		return;
+	}
+
+	calculateWorldGeometry();
+
+	geometryVersion = transform.version;
+	geometryValid = true;
+}
+
+//forces a rebuild on the next use
+void Collider::invalidateWorldGeometry()
+{
+	geometryValid = false;
+}
+
+//resize the hull, allocating it the first time
+void Collider::setHull(Vector2 min, Vector2 max)
+{
+	if (hull == nullptr)
+	{
+		hull = new AABB{ min, max };
+		return;
+	}
+
+	hull->min = min;
+	hull->max = max;
+}
+
+//smallest box around the world points
+void Collider::fitHullToPoints()
+{
+	Range xRange = {};
+	Range yRange = {};
+
+	size_t size = worldPoints.size();
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Vector2 point = worldPoints[i];
+
+		xRange.min = point.x < xRange.min ? point.x : xRange.min;
+		xRange.max = point.x > xRange.max ? point.x : xRange.max;
+
+		yRange.min = point.y < yRange.min ? point.y : yRange.min;
+		yRange.max = point.y > yRange.max ? point.y : yRange.max;
+	}
+
+	setHull(Vector2{ xRange.min, yRange.min }, Vector2{ xRange.max, yRange.max });
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <limits>
+#include <assert.h>
 #include "maths_library.h"
 #include "transform.h"
 
@@ -11,6 +12,9 @@ class Application2D;
 //anything closer to another thing than this range is considered equal to the other thing
 #define EPSILON 1e-5f
 
+//the most projection axes one shape can give a SAT test, polygons can't have more points than this
+#define MAX_SHAPE_AXES 16
+
 //defines the collider type
 enum class BoundsType
 {
@@ -22,6 +26,9 @@ enum class BoundsType
 	CIRCLE,
 };
 
+//how many collider types there are, used to size tables indexed by BoundsType
+#define BOUNDS_TYPE_COUNT 6
+
 /*
 * struct Range
 * 
@@ -35,6 +42,35 @@ struct Range
 	float max = -std::numeric_limits<float>::max();
 };
 
+/*
+* struct AxisBuffer
+*
+* fixed size list of projection axes for one SAT test, lives on the stack
+* so that testing a pair of shapes doesn't touch the heap.
+* big enough to hold the axes of both shapes
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct AxisBuffer
+{
+	Vector2 axes[MAX_SHAPE_AXES * 2]; //axis storage
+	size_t size = 0; //how many axes are in use
+
+	/*
+	* push
+	*
+	* adds an axis to the end of the list
+	*
+	* @param Vector2 axis - the axis to add
+	* @returns void
+	*/
+	void push(Vector2 axis)
+	{
+		assert(size < MAX_SHAPE_AXES * 2);
+		axes[size++] = axis;
+	}
+};
+
 /*
 * class Collider
 * abstract class
@@ -52,6 +88,14 @@ public:
 
 	AABB* hull = nullptr; //aabb hull
 
+	//world-space geometry, rebuilt by updateWorldGeometry only when the transform's version changes
+	//-----------------------------------------------------------
+	std::vector<Vector2> worldPoints; //vertices with the global transformation applied
+	std::vector<Vector2> worldAxes; //projection axes of the shape's sides with the global transformation applied
+	unsigned int geometryVersion = 0; //transform version the cached geometry was built from
+	bool geometryValid = false; //false until the cache is built, or after the shape itself is changed
+	//-----------------------------------------------------------
+
 	unsigned int layer = 0b11111; //collider bits, if tested against another collider they must both have a 1 at at least one position
 
 	/*
@@ -71,11 +115,13 @@ public:
 	* abstract function
 	*
 	* calculates all of the axes needed to satsify testing collisions with Seperating Axis Theorem
+	* and adds them to the end of the buffer
 	*
 	* @param Collider& - the other shape in the collision test, this is necessary for circles
-	* @returns std::vector<Vector2> - a list of directional vectors to test
+	* @param AxisBuffer& - the list of directional vectors to test
+	* @returns void
 	*/
-	virtual std::vector<Vector2> getAxes(Collider&) = 0;
+	virtual void getAxes(Collider&, AxisBuffer&) = 0;
 
 	/*
 	* project
@@ -122,12 +168,63 @@ public:
 
 	/*
 	* generateHull
+	*
+	* makes sure hull is the minimum AABB that contains the shape
+	* the hull is part of the cached world geometry, so this only does work after the transform changed
+	* @returns void
+	*/
+	void generateHull();
+
+	/*
+	* updateWorldGeometry
+	*
+	* rebuilds worldPoints, worldAxes and the hull if the transform
+	* has changed since they were last built, otherwise does nothing
+	*
+	* @returns void
+	*/
+	void updateWorldGeometry();
+
+	/*
+	* invalidateWorldGeometry
+	*
+	* forces the cached world geometry to be rebuilt the next time it is used,
+	* call after changing the shape itself (points, radius, etc.)
+	*
+	* @returns void
+	*/
+	void invalidateWorldGeometry();
+
+	/*
+	* calculateWorldGeometry
 	* abstract function
 	*
-	* calculates the minimum AABB that contains the shape
+	* fills worldPoints and worldAxes from the shape and the global transformation,
+	* then sizes the hull around the shape
+	*
+	* @returns void
+	*/
+	virtual void calculateWorldGeometry() = 0;
+
+	/*
+	* setHull
+	*
+	* resizes the hull, it is only allocated the first time
+	*
+	* @param Vector2 min - the top-left corner of the hull
+	* @param Vector2 max - the bottom-right corner of the hull
+	* @returns void
+	*/
+	void setHull(Vector2 min, Vector2 max);
+
+	/*
+	* fitHullToPoints
+	*
+	* sizes the hull to the smallest box containing every point in worldPoints
+	*
 	* @returns void
 	*/
-	virtual void generateHull() = 0;
+	void fitHullToPoints();
 
 	/*
 	* render
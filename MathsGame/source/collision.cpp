@@ -1,7 +1,208 @@
 #include "collision.h"
+#include "circle.h"
+#include "AABB.h"
 #include <vector>
 #include <limits>
 #include <typeinfo>
+#include <stdlib.h>
+#include <new>
+#include <assert.h>
+
+#ifdef COLLISION_COUNT_ALLOCATIONS
+//counts every heap allocation each thread makes so the narrowphase can prove it doesn't make any
+static thread_local size_t allocationCount = 0;
+
+void* operator new(size_t size)
+{
+	allocationCount++;
+
+	void* memory = malloc(size > 0 ? size : 1);
+
+	if (memory == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+//the sized delete, called when the size of the memory is known
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+#endif
+
+//where the counters for tests run on this thread go, nullptr for the solver's own stats
+static thread_local NarrowphaseStats* threadStats = nullptr;
+
+//gets the signed penetration of two projections onto the same axis, positive when B is further along the axis than A
+static bool overlap(Range A_proj, Range B_proj, float& penetration)
+{
+	//test if the ranges overlap
+	if (A_proj.min > B_proj.max || B_proj.min > A_proj.max)
+	{
+		return false;
+	}
+
+	//calculate smallest penetration from ranges
+	float p1 = B_proj.max - A_proj.min;
+	float p2 = A_proj.max - B_proj.min;
+
+	//get the smallest value
+	penetration = abs(p1) < abs(p2) ? p1 : p2;
+
+	//reverse the penetration, the range calculation is the wrong way around
+	if (A_proj.min > B_proj.min)
+	{
+		penetration *= -1.0f;
+	}
+
+	return true;
+}
+
+//true if the AABB's sides still line up with the world axes, so its hull is the box itself
+static bool isAxisAligned(Collider* box)
+{
+	box->updateWorldGeometry();
+
+	Vector2 side = box->worldAxes[0];
+
+	return abs(side.x) < EPSILON || abs(side.y) < EPSILON;
+}
+
+//gets the corners of an AABB or polygon in order around its edge, and the outward normal of the edge from each corner to the next
+static size_t getEdgeLoop(Collider* shape, Vector2* vertices, Vector2* normals)
+{
+	shape->updateWorldGeometry();
+
+	std::vector<Vector2>& points = shape->worldPoints;
+	size_t size = points.size();
+
+	assert(size <= MAX_SHAPE_AXES);
+
+	if (shape->colliderType == BoundsType::AABB)
+	{
+		//the corners of an AABB are stored by row, not in order around the edge
+		vertices[0] = points[0];
+		vertices[1] = points[1];
+		vertices[2] = points[3];
+		vertices[3] = points[2];
+	}
+	else
+	{
+		for (size_t i = 0; i < size; i++)
+		{
+			vertices[i] = points[i];
+		}
+	}
+
+	//twice the signed area, its sign says which way around the corners go
+	float area = 0.0f;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Vector2 current = vertices[i];
+		Vector2 next = vertices[(i + 1) % size];
+
+		area += current.x * next.y - next.x * current.y;
+	}
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Vector2 edge = vertices[(i + 1) % size] - vertices[i];
+
+		normals[i] = area > 0 ? Vector2{ edge.y, -edge.x } : Vector2{ -edge.y, edge.x };
+		normals[i].normalise();
+	}
+
+	return size;
+}
+
+//gets the index of the normal pointing the most along a direction
+static size_t mostAligned(Vector2* normals, size_t size, Vector2 direction)
+{
+	size_t best = 0;
+	float bestDot = normals[0].dot(direction);
+
+	for (size_t i = 1; i < size; i++)
+	{
+		float dot = normals[i].dot(direction);
+
+		if (dot > bestDot)
+		{
+			best = i;
+			bestDot = dot;
+		}
+	}
+
+	return best;
+}
+
+//keeps the part of a segment behind a plane, a point made by cutting the segment gets the clip's feature
+static int clipSegment(Vector2* points, unsigned int* features, Vector2 planeNormal, float planeOffset, unsigned int clipFeature)
+{
+	float firstDistance = planeNormal.dot(points[0]) - planeOffset;
+	float secondDistance = planeNormal.dot(points[1]) - planeOffset;
+
+	Vector2 kept[2];
+	unsigned int keptFeatures[2];
+	int count = 0;
+
+	if (firstDistance <= 0)
+	{
+		kept[count] = points[0];
+		keptFeatures[count++] = features[0];
+	}
+
+	if (secondDistance <= 0)
+	{
+		kept[count] = points[1];
+		keptFeatures[count++] = features[1];
+	}
+
+	//the segment crosses the plane, keep the point where it crosses
+	if (firstDistance * secondDistance < 0)
+	{
+		float t = firstDistance / (firstDistance - secondDistance);
+
+		kept[count] = points[0] + (points[1] - points[0]) * t;
+		keptFeatures[count++] = clipFeature;
+	}
+
+	for (int i = 0; i < count; i++)
+	{
+		points[i] = kept[i];
+		features[i] = keptFeatures[i];
+	}
+
+	return count;
+}
+
+//fill the dispatch table, every pair without a closed-form test uses SAT
+CollisionSolver::CollisionSolver()
+{
+	for (int i = 0; i < BOUNDS_TYPE_COUNT; i++)
+	{
+		for (int j = 0; j < BOUNDS_TYPE_COUNT; j++)
+		{
+			pairTests[i][j] = &CollisionSolver::separatingAxisTest;
+		}
+	}
+
+	int circle = (int)BoundsType::CIRCLE;
+	int aabb = (int)BoundsType::AABB;
+
+	pairTests[circle][circle] = &CollisionSolver::circleCircleTest;
+	pairTests[circle][aabb] = &CollisionSolver::circleAABBTest;
+	pairTests[aabb][circle] = &CollisionSolver::AABBCircleTest;
+	pairTests[aabb][aabb] = &CollisionSolver::AABBAABBTest;
+}
 
 //get a pointer to the singleton
 CollisionSolver* CollisionSolver::getInstance()
@@ -18,6 +219,24 @@ CollisionSolver* CollisionSolver::getInstance()
 	return singleton;
 }
 
+//zero the narrowphase counters
+void CollisionSolver::resetStats()
+{
+	stats = NarrowphaseStats{};
+}
+
+//send this thread's counters somewhere else
+void CollisionSolver::redirectStats(NarrowphaseStats* target)
+{
+	threadStats = target;
+}
+
+//the counters for the calling thread
+NarrowphaseStats& CollisionSolver::counters()
+{
+	return threadStats == nullptr ? stats : *threadStats;
+}
+
 //invokes doAdvancedIntersectionTest and returns whether the collision occured or not
 bool CollisionSolver::doSimpleIntersectionTest(Collider* A, Collider* B)
 {
@@ -27,218 +246,399 @@ bool CollisionSolver::doSimpleIntersectionTest(Collider* A, Collider* B)
 //tests if two shapes are intersecting using the seperating axis theorem
 SimpleCollision CollisionSolver::doAdvancedIntersectionTest(Collider * A, Collider * B)
 {
-	std::vector<Vector2> axes;
+	Vector2 bestAxis = Vector2{};
+	float smallestPenetration = 0.0f;
+
+	SimpleCollision result;
+	result.A = A;
+	result.B = B;
+	result.intersection = dispatchTest(A, B, bestAxis, smallestPenetration);
+	result.MTV = bestAxis * smallestPenetration;
+
+	return result;
+}
+
+//tests if two bodies are intersecting using the seperating axis theorem and returns detailed information about the collision
+AdvancedCollision CollisionSolver::doBaseEntityIntersectionTest(BaseEntity * A, BaseEntity * B, float deltaTime)
+{
+	Vector2 bestAxis = Vector2{};
+	float smallestPenetration = 0.0f;
 
-	//get the axes from each shape to test
-	std::vector<Vector2> A_axes = A->getAxes(*B);
-	std::vector<Vector2> B_axes = B->getAxes(*A);
+	AdvancedCollision result;
+	result.A = A;
+	result.B = B;
+	result.intersection = dispatchTest(A->collider, B->collider, bestAxis, smallestPenetration);
+	result.MTV = bestAxis * smallestPenetration;
 
-	//add A's axes to test to the common list
-	axes.insert(axes.end(), A_axes.begin(), A_axes.end());
+	if (result.intersection)
+	{
+		result.normal = result.MTV.normalised();
+	}
 
-	//add B's axes to test to the common list
-	axes.insert(axes.end(), B_axes.begin(), B_axes.end());
+	return result;
+}
 
-	size_t size = axes.size();
+//look up the test for the pair of collider types and run it
+bool CollisionSolver::dispatchTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+#ifdef COLLISION_COUNT_ALLOCATIONS
+	size_t allocationsBefore = allocationCount;
+#endif
 
-	Vector2 bestAxis = Vector2{};
-	float smallestPenetration = std::numeric_limits<float>().max();
+	NarrowphaseStats& current = counters();
 
-	for (size_t i = 0; i < size; i++)
+	current.tests++;
+
+	PairTest test = pairTests[(int)A->colliderType][(int)B->colliderType];
+	bool intersection = (this->*test)(A, B, bestAxis, smallestPenetration);
+
+#ifdef COLLISION_COUNT_ALLOCATIONS
+	current.allocations += allocationCount - allocationsBefore;
+#endif
+
+	return intersection;
+}
+
+//compare the distance between the centres to the sum of the radii
+bool CollisionSolver::circleCircleTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+	A->updateWorldGeometry();
+	B->updateWorldGeometry();
+
+	float radiusSum = ((Circle*)A)->radius + ((Circle*)B)->radius;
+
+	Vector2 between = B->worldPoints[0] - A->worldPoints[0];
+	float sqrDistance = between.sqrMagnitude();
+
+	if (sqrDistance > radiusSum * radiusSum)
 	{
-		//get the smallest and largest dot products of the shapes
-		Range A_proj = A->project(axes[i]);
-		Range B_proj = B->project(axes[i]);
-		 
-		//test if the ranges overlap
-		if (A_proj.min <= B_proj.max && B_proj.min <= A_proj.max)
+		bestAxis = Vector2{};
+		smallestPenetration = 0.0f;
+		return false;
+	}
+
+	float distance = sqrtf(sqrDistance);
+
+	//the centres are on top of each other, any direction will seperate them
+	if (distance < EPSILON)
+	{
+		bestAxis = Vector2{ 0, 1 };
+		smallestPenetration = radiusSum;
+		return true;
+	}
+
+	bestAxis = between / distance;
+	smallestPenetration = radiusSum - distance;
+	return true;
+}
+
+//find the closest point in the box to the circle's centre
+bool CollisionSolver::circleAABBTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+	if (!isAxisAligned(B))
+	{
+		return separatingAxisTest(A, B, bestAxis, smallestPenetration);
+	}
+
+	A->updateWorldGeometry();
+
+	float radius = ((Circle*)A)->radius;
+	Vector2 centre = A->worldPoints[0];
+	Vector2 min = B->hull->min;
+	Vector2 max = B->hull->max;
+
+	//clamp the centre to the box
+	Vector2 closest = centre;
+	closest.x = closest.x < min.x ? min.x : (closest.x > max.x ? max.x : closest.x);
+	closest.y = closest.y < min.y ? min.y : (closest.y > max.y ? max.y : closest.y);
+
+	Vector2 between = closest - centre;
+	float sqrDistance = between.sqrMagnitude();
+
+	//the centre is outside of the box, the closest point is on the boundary
+	if (sqrDistance > EPSILON * EPSILON)
+	{
+		if (sqrDistance > radius * radius)
 		{
-			//calculate smallest penetration from ranges
-			float p1 = B_proj.max - A_proj.min;
-			float p2 = A_proj.max - B_proj.min;
+			bestAxis = Vector2{};
+			smallestPenetration = 0.0f;
+			return false;
+		}
+
+		float distance = sqrtf(sqrDistance);
+
+		bestAxis = between / distance;
+		smallestPenetration = radius - distance;
+		return true;
+	}
+
+	//the centre is inside the box, push it out through the nearest side
+	float left = centre.x - min.x;
+	float right = max.x - centre.x;
+	float top = centre.y - min.y;
+	float bottom = max.y - centre.y;
+
+	float horizontal = left < right ? left : right;
+	float vertical = top < bottom ? top : bottom;
+
+	if (horizontal < vertical)
+	{
+		bestAxis = Vector2{ left < right ? 1.0f : -1.0f, 0 };
+		smallestPenetration = horizontal + radius;
+	}
+	else
+	{
+		bestAxis = Vector2{ 0, top < bottom ? 1.0f : -1.0f };
+		smallestPenetration = vertical + radius;
+	}
+
+	return true;
+}
+
+//same as circleAABBTest, with the MTV reversed so it still points from A to B
+bool CollisionSolver::AABBCircleTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+	bool intersection = circleAABBTest(B, A, bestAxis, smallestPenetration);
+
+	smallestPenetration *= -1.0f;
+
+	return intersection;
+}
+
+//compare the boxes' extents on x and y
+bool CollisionSolver::AABBAABBTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+	if (!isAxisAligned(A) || !isAxisAligned(B))
+	{
+		return separatingAxisTest(A, B, bestAxis, smallestPenetration);
+	}
+
+	AABB* A_hull = A->hull;
+	AABB* B_hull = B->hull;
+
+	float xPenetration = 0.0f;
+	float yPenetration = 0.0f;
+
+	if (!overlap(Range{ A_hull->min.x, A_hull->max.x }, Range{ B_hull->min.x, B_hull->max.x }, xPenetration) ||
+		!overlap(Range{ A_hull->min.y, A_hull->max.y }, Range{ B_hull->min.y, B_hull->max.y }, yPenetration))
+	{
+		bestAxis = Vector2{};
+		smallestPenetration = 0.0f;
+		return false;
+	}
+
+	//x is tested first by SAT, so it wins a tie
+	if (abs(yPenetration) < abs(xPenetration))
+	{
+		bestAxis = Vector2{ 0, 1 };
+		smallestPenetration = yPenetration;
+	}
+	else
+	{
+		bestAxis = Vector2{ 1, 0 };
+		smallestPenetration = xPenetration;
+	}
+
+	return true;
+}
+
+//the general SAT test, for pairs without a closed-form test
+bool CollisionSolver::separatingAxisTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration)
+{
+	counters().satTests++;
+
+	AxisBuffer axes;
 
-			//get the smallest value
-			float penetration = abs(p1) < abs(p2) ? p1 : p2;
+	//get the axes from each shape to test, A's first then B's
+	A->getAxes(*B, axes);
+	B->getAxes(*A, axes);
 
+	bool intersection = true;
+
+	bestAxis = Vector2{};
+	smallestPenetration = std::numeric_limits<float>().max();
+
+	for (size_t i = 0; i < axes.size; i++)
+	{
+		//get the smallest and largest dot products of the shapes
+		Range A_proj = A->project(axes.axes[i]);
+		Range B_proj = B->project(axes.axes[i]);
+
+		float penetration = 0.0f;
+
+		if (overlap(A_proj, B_proj, penetration))
+		{
 			//test if it is smaller than the smallest global penetration
 			if (abs(penetration) < abs(smallestPenetration))
 			{
-				bestAxis = axes[i];
+				bestAxis = axes.axes[i];
 				smallestPenetration = penetration;
-
-				if (A_proj.min > B_proj.min)
-				{
-					smallestPenetration *= -1.0f;
-				}
 			}
-
 		}
 		else
 		{
 			//bail out, a seperating axis was found
-			SimpleCollision fail;
-			fail.A = A;
-			fail.B = B;
-			fail.intersection = false;
-			fail.MTV = Vector2{};
-			return fail;
+			intersection = false;
+			bestAxis = Vector2{};
+			smallestPenetration = 0.0f;
+			break;
 		}
 	}
 
-	//collision occured, return the collision information
-	SimpleCollision success;
-	success.A = A;
-	success.B = B;
-	success.intersection = true;
-	success.MTV = bestAxis * smallestPenetration;
-	return success;
+	return intersection;
 }
 
-//tests if two bodies are intersecting using the seperating axis theorem and returns detailed information about the collision
-AdvancedCollision CollisionSolver::doBaseEntityIntersectionTest(BaseEntity * A, BaseEntity * B, float deltaTime)
+//calculates the contact manifold of the two shapes
+AdvancedCollision CollisionSolver::calculateContacts(AdvancedCollision partial)
 {
-	std::vector<Vector2> axes;
-	std::vector<float> penetrations;
+	partial.contactCount = 0;
 
-	//get the axes from each shape to test
-	std::vector<Vector2> A_axes = A->collider->getAxes(*B->collider);
-	std::vector<Vector2> B_axes = B->collider->getAxes(*A->collider);
+	BoundsType A_type = partial.A->collider->colliderType;
+	BoundsType B_type = partial.B->collider->colliderType;
 
-	//add A's axes to test to the common list
-	axes.insert(axes.end(), A_axes.begin(), A_axes.end());
+	bool A_edges = A_type == BoundsType::AABB || A_type == BoundsType::POLYGON;
+	bool B_edges = B_type == BoundsType::AABB || B_type == BoundsType::POLYGON;
 
-	//add B's axes to test to the common list
-	axes.insert(axes.end(), B_axes.begin(), B_axes.end());
+	//clipping needs a face on both shapes
+	if (A_edges && B_edges && clipContacts(partial))
+	{
+		return partial;
+	}
 
-	size_t size = axes.size();
+	pointContacts(partial);
 
-	Vector2 bestAxis = Vector2{};
-	float smallestPenetration = std::numeric_limits<float>().max();
+	return partial;
+}
 
-	Vector2 A_bestAxis = Vector2{};
-	float A_smallestPenetration = std::numeric_limits<float>().max();
+//clip the incident edge against the reference face
+bool CollisionSolver::clipContacts(AdvancedCollision& partial)
+{
+	Vector2 A_vertices[MAX_SHAPE_AXES];
+	Vector2 A_normals[MAX_SHAPE_AXES];
+	Vector2 B_vertices[MAX_SHAPE_AXES];
+	Vector2 B_normals[MAX_SHAPE_AXES];
 
-	Vector2 B_bestAxis = Vector2{};
-	float B_smallestPenetration = std::numeric_limits<float>().max();
+	size_t A_size = getEdgeLoop(partial.A->collider, A_vertices, A_normals);
+	size_t B_size = getEdgeLoop(partial.B->collider, B_vertices, B_normals);
 
-	size_t bSize = B_axes.size();
+	Vector2 normal = partial.normal;
 
-	for (size_t i = 0; i < size; i++)
-	{
-		//get the smallest and largest dot products of the shapes
-		Range A_proj = A->collider->project(axes[i]);
-		Range B_proj = B->collider->project(axes[i]);
+	//the faces of each shape that face the other shape the most
+	size_t A_face = mostAligned(A_normals, A_size, normal);
+	size_t B_face = mostAligned(B_normals, B_size, normal * -1.0f);
 
-		//test if the ranges overlap
-		if (A_proj.min <= B_proj.max && B_proj.min <= A_proj.max)
-		{
-			//calculate smallest penetration from ranges
-			float p1 = B_proj.max - A_proj.min;
-			float p2 = A_proj.max - B_proj.min;
+	float A_alignment = A_normals[A_face].dot(normal);
+	float B_alignment = B_normals[B_face].dot(normal * -1.0f);
 
-			//get the smallest value
-			float penetration = abs(p1) < abs(p2) ? p1 : p2;
+	//A is the reference unless B's face is clearly closer to the normal, the tolerance stops the choice flickering
+	bool flip = B_alignment > A_alignment + CONTACT_FACE_TOLERANCE;
 
-			penetrations.push_back(penetration);
+	Vector2* refVertices = flip ? B_vertices : A_vertices;
+	size_t refSize = flip ? B_size : A_size;
+	size_t refFace = flip ? B_face : A_face;
+	Vector2 refNormal = flip ? B_normals[B_face] : A_normals[A_face];
 
-			//test if it is smaller than the smallest global penetration
-			if (abs(penetration) < abs(smallestPenetration))
-			{
-				bestAxis = axes[i];
-				smallestPenetration = penetration;
+	Vector2* incVertices = flip ? A_vertices : B_vertices;
+	Vector2* incNormals = flip ? A_normals : B_normals;
+	size_t incSize = flip ? A_size : B_size;
 
-				//reverse the penetration, the range calculation is the wrong way around
-				if (A_proj.min > B_proj.min)
-				{
-					smallestPenetration *= -1.0f;
-				}
-			}
+	Vector2 ref1 = refVertices[refFace];
+	Vector2 ref2 = refVertices[(refFace + 1) % refSize];
 
-			//test if it is smaller than A's smallest penetration
-			if (abs(penetration) < abs(A_smallestPenetration) && i < size - bSize)
-			{
-				A_bestAxis = axes[i];
-				A_smallestPenetration = penetration;
-
-				//reverse the penetration, the range calculation is the wrong way around
-				if (A_proj.min > B_proj.min)
-				{
-					A_smallestPenetration *= -1.0f;
-				}
-			}
+	//the incident edge is the one facing against the reference face the most
+	size_t incFace = mostAligned(incNormals, incSize, refNormal * -1.0f);
 
-			//test if it is smaller than A's smallest penetration
-			if (abs(penetration) < abs(B_smallestPenetration) && i >= size - bSize)
-			{
-				B_bestAxis = axes[i];
-				B_smallestPenetration = penetration;
-
-				//reverse the penetration, the range calculation is the wrong way around
-				if (A_proj.min > B_proj.min)
-				{
-					B_smallestPenetration *= -1.0f;
-				}
-			}
+	Vector2 incident[2] = { incVertices[incFace], incVertices[(incFace + 1) % incSize] };
+	unsigned int features[2] = { 0, 1 };
 
+	Vector2 tangent = (ref2 - ref1).normalised();
 
-		}
-		else
+	//cut the incident edge down to the sides of the reference face
+	if (clipSegment(incident, features, tangent * -1.0f, -tangent.dot(ref1), 2) < 2)
+	{
+		return false;
+	}
+
+	if (clipSegment(incident, features, tangent, tangent.dot(ref2), 3) < 2)
+	{
+		return false;
+	}
+
+
+	Vector2 A_position = partial.A->collider->transform.globalTransform.getTranslation();
+	Vector2 B_position = partial.B->collider->transform.globalTransform.getTranslation();
+
+	float refOffset = refNormal.dot(ref1);
+
+	for (int i = 0; i < 2; i++)
+	{
+		float separation = refNormal.dot(incident[i]) - refOffset;
+
+		//this end of the incident edge is in front of the reference face
+		if (separation > EPSILON)
 		{
-			//bail out, a seperating axis was found
-			AdvancedCollision fail;
-			fail.A = A;
-			fail.B = B;
-			fail.intersection = false;
-			fail.MTV = Vector2{};
-			return fail;
+			continue;
 		}
-	}
 
+		//halfway between the incident point and the reference face
+		Vector2 point = incident[i] - refNormal * (separation * 0.5f);
 
-	//collision occured, return the collision information
-	AdvancedCollision success;
-	success.A = A;
-	success.B = B;
-	success.MTV = bestAxis * smallestPenetration;
-	success.normal = success.MTV.normalised();
-	success.intersection = true;
+		ContactPoint& contact = partial.contacts[partial.contactCount++];
 
-	return success;
+		contact.A_contact = point - A_position;
+		contact.B_contact = point - B_position;
+		contact.penetration = -separation;
+		contact.id = (flip ? 1u << 24 : 0u) | ((unsigned int)refFace << 16) | ((unsigned int)incFace << 8) | features[i];
+	}
+
+	return partial.contactCount > 0;
 }
 
-//calculates the contact point relative to the two shapes
-AdvancedCollision CollisionSolver::calculateContacts(AdvancedCollision partial)
+//a single contact from a circle's deepest point, or from the support points
+void CollisionSolver::pointContacts(AdvancedCollision& partial)
 {
+	Vector2 normal = partial.normal;
+
+	//get the positions with transformations
+	Vector2 A_position = partial.A->collider->transform.globalTransform.getTranslation();
+	Vector2 B_position = partial.B->collider->transform.globalTransform.getTranslation();
+
+	ContactPoint& contact = partial.contacts[0];
+	partial.contactCount = 1;
 
-	if (partial.A->invMass + partial.B->invMass > 0)
+	contact.penetration = partial.MTV.magnitude();
+	contact.id = 0;
+
+	//the deepest point of a circle is its radius along the normal
+	if (partial.A->collider->colliderType == BoundsType::CIRCLE)
 	{
-		int a = 0;
+		contact.A_contact = normal * ((Circle*)partial.A->collider)->radius;
+		contact.B_contact = (A_position + contact.A_contact) - B_position;
+		return;
 	}
 
-	Vector2 normal = partial.MTV.normalised();
+	if (partial.B->collider->colliderType == BoundsType::CIRCLE)
+	{
+		contact.B_contact = normal * -((Circle*)partial.B->collider)->radius;
+		contact.A_contact = (B_position + contact.B_contact) - A_position;
+		return;
+	}
 
 	std::vector<Vector2> A_supports = partial.A->collider->support(normal);
 	std::vector<Vector2> B_supports = partial.B->collider->support(normal * -1.0f);
 
-	Matrix3 A_globalMatrix = partial.A->collider->transform.globalTransform;
-	Matrix3 B_globalMatrix = partial.B->collider->transform.globalTransform;
-	
-	//get the positions with transformations
-	Vector2 A_position = Vector2{ A_globalMatrix[2][0], A_globalMatrix[2][1] };
-	Vector2 B_position = Vector2{ B_globalMatrix[2][0], B_globalMatrix[2][1] };
-
 	if (A_supports.size() == 1)
 	{
 		//get the contact points relative to A
-		partial.A_contact = A_supports[0];
-		partial.B_contact = (A_position + partial.A_contact) - B_position;
+		contact.A_contact = A_supports[0];
+		contact.B_contact = (A_position + contact.A_contact) - B_position;
 
 	}
 	else if (B_supports.size() == 1)
 	{
 		//get the contact points relative to B
-		partial.B_contact = B_supports[0];
-		partial.A_contact = (B_position + partial.B_contact) - A_position;
+		contact.B_contact = B_supports[0];
+		contact.A_contact = (B_position + contact.B_contact) - A_position;
 	}
 	else
 	{
@@ -254,11 +654,11 @@ AdvancedCollision CollisionSolver::calculateContacts(AdvancedCollision partial)
 
 		average = average / (float)supportSize;
 
-		partial.A_contact = average;
+		contact.A_contact = average;
 
-	    average = Vector2{};
+		average = Vector2{};
 
-	    supportSize = B_supports.size();
+		supportSize = B_supports.size();
 
 		for (size_t i = 0; i < supportSize; i++)
 		{
@@ -267,9 +667,6 @@ AdvancedCollision CollisionSolver::calculateContacts(AdvancedCollision partial)
 
 		average = average / (float)supportSize;
 
-		partial.B_contact = average;
+		contact.B_contact = average;
 	}
-
-	return partial;
-
-}
\ No newline at end of file
+}
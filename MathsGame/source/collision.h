@@ -4,6 +4,27 @@
 //macro that defines the instance with a name
 #define COLL_SOLVER CollisionSolver::getInstance()
 
+//most points a contact manifold holds, two is enough for two edges lying against each other
+#define MAX_MANIFOLD_POINTS 2
+
+//how much closer to the normal the second shape's face has to be before it is used as the reference face
+#define CONTACT_FACE_TOLERANCE 0.001f
+
+/*
+* struct ContactPoint
+*
+* one point where two colliding shapes touch
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct ContactPoint
+{
+	Vector2 A_contact; //contact point relative to A
+	Vector2 B_contact; //contact point relative to B
+	float penetration = 0.0f; //how far the shapes overlap at this point, along the normal
+	unsigned int id = 0; //the edges and corners that made the point, the same features give the same id every update
+};
+
 /*
 * struct SimpleCollision
 *
@@ -45,11 +66,25 @@ struct AdvancedCollision
 
 	Vector2 MTV; //minimum translation vector
 	Vector2 normal; //direction of collision
-	Vector2 A_contact; //contact point relative to A
-	Vector2 B_contact; //contact point relative to B
+	ContactPoint contacts[MAX_MANIFOLD_POINTS]; //the contact manifold, filled in by calculateContacts
+	int contactCount = 0; //how many of the contacts are used
 
 };
 
+/*
+* struct NarrowphaseStats
+*
+* counters for the SAT tests the solver has run since they were last reset
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct NarrowphaseStats
+{
+	size_t tests = 0; //how many pairs of shapes were tested
+	size_t satTests = 0; //how many of those had no closed-form test and fell back to SAT
+	size_t allocations = 0; //heap allocations made during those tests, only counted when COLLISION_COUNT_ALLOCATIONS is defined
+};
+
 /*
 * class CollisionSolver
 * 
@@ -73,6 +108,28 @@ public:
 	*/
 	static CollisionSolver* getInstance();
 
+	NarrowphaseStats stats; //counters for the tests run since the last resetStats()
+
+	/*
+	* resetStats
+	*
+	* sets all of the narrowphase counters back to zero
+	*
+	* @returns void
+	*/
+	void resetStats();
+
+	/*
+	* redirectStats
+	*
+	* sends the counters for tests run on the calling thread to target instead of stats,
+	* so threads running tests at the same time don't write to the same counters
+	*
+	* @param NarrowphaseStats* target - the counters to use, nullptr goes back to stats
+	* @returns void
+	*/
+	void redirectStats(NarrowphaseStats* target);
+
 	/*
 	* doSimpleIntersectionTest
 	*
@@ -121,8 +178,9 @@ public:
 	/*
 	* calculateContacts
 	*
-	* takes a partially completed advanced collision and uses support functions
-	* to add contact points to the collision information
+	* takes a partially completed advanced collision and adds its contact manifold.
+	* two shapes made of edges (AABBs and polygons) get up to two points by clipping,
+	* circles get the deepest point of the circle, anything else uses support functions
 	*
 	* @param AdvancedCollision partial - the advanced collision that took place and was resolved
 	* @returns AdvancedCollision - 'partial' with contact points
@@ -131,13 +189,135 @@ public:
 
 protected:
 
+	//a narrowphase test for one pair of collider types, every test shares this signature so it can sit in the dispatch table
+	typedef bool (CollisionSolver::*PairTest)(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	PairTest pairTests[BOUNDS_TYPE_COUNT][BOUNDS_TYPE_COUNT]; //the test to use for each pair of BoundsTypes, indexed [A][B]
+
+	/*
+	* counters
+	*
+	* gets the counters tests on the calling thread should add to
+	*
+	* @returns NarrowphaseStats& - the thread's redirected counters, or stats
+	*/
+	NarrowphaseStats& counters();
+
+	/*
+	* dispatchTest
+	*
+	* picks the test for A and B's collider types from pairTests and runs it.
+	* the result always describes the MTV from A to B, whichever test was used
+	*
+	* @param Collider* A - the first shape to test
+	* @param Collider* B - the second shape to test
+	* @param Vector2& bestAxis - set to the axis with the smallest penetration
+	* @param float& smallestPenetration - set to the signed penetration along bestAxis
+	* @returns bool - the result of the intersection test
+	*/
+	bool dispatchTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* circleCircleTest
+	*
+	* closed-form test of two circles, compares the distance between their centres to their radii
+	*
+	* @param Collider* A - the first circle
+	* @param Collider* B - the second circle
+	* @param Vector2& bestAxis - set to the direction from A's centre to B's
+	* @param float& smallestPenetration - set to the overlap of the two circles
+	* @returns bool - the result of the intersection test
+	*/
+	bool circleCircleTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* circleAABBTest
+	*
+	* closed-form test of a circle and an AABB, using the closest point in the box to the circle's centre.
+	* if the AABB has been rotated it isn't axis-aligned anymore, so this falls back to SAT
+	*
+	* @param Collider* A - the circle
+	* @param Collider* B - the AABB
+	* @param Vector2& bestAxis - set to the axis with the smallest penetration
+	* @param float& smallestPenetration - set to the signed penetration along bestAxis
+	* @returns bool - the result of the intersection test
+	*/
+	bool circleAABBTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* AABBCircleTest
+	*
+	* circleAABBTest with the shapes the other way around
+	*
+	* @param Collider* A - the AABB
+	* @param Collider* B - the circle
+	* @param Vector2& bestAxis - set to the axis with the smallest penetration
+	* @param float& smallestPenetration - set to the signed penetration along bestAxis
+	* @returns bool - the result of the intersection test
+	*/
+	bool AABBCircleTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* AABBAABBTest
+	*
+	* closed-form test of two AABBs, compares their extents along x and y.
+	* if either AABB has been rotated this falls back to SAT
+	*
+	* @param Collider* A - the first AABB
+	* @param Collider* B - the second AABB
+	* @param Vector2& bestAxis - set to the axis with the smallest penetration
+	* @param float& smallestPenetration - set to the signed penetration along bestAxis
+	* @returns bool - the result of the intersection test
+	*/
+	bool AABBAABBTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* separatingAxisTest
+	*
+	* the general SAT test, used by every pair without a closed-form test.
+	* the axes are kept in a buffer on the stack so nothing is allocated
+	*
+	* @param Collider* A - the first shape to test
+	* @param Collider* B - the second shape to test
+	* @param Vector2& bestAxis - set to the axis with the smallest penetration
+	* @param float& smallestPenetration - set to the signed penetration along bestAxis
+	* @returns bool - the result of the intersection test
+	*/
+	bool separatingAxisTest(Collider* A, Collider* B, Vector2& bestAxis, float& smallestPenetration);
+
+	/*
+	* clipContacts
+	*
+	* builds the manifold of two shapes made of edges. the edge facing along the normal the
+	* most is the reference face, the other shape's edge facing it the most is the incident edge.
+	* the incident edge is cut to the width of the reference face and the parts of it behind
+	* the face are the contacts. each contact's id is made from the two edges and which end of
+	* the incident edge it came from, so the same contact can be found on the next update
+	* https://dyn4j.org/2011/11/contact-points-using-clipping/
+	*
+	* @param AdvancedCollision& partial - the collision to add the manifold to
+	* @returns bool - false if clipping didn't find any points
+	*/
+	bool clipContacts(AdvancedCollision& partial);
+
+	/*
+	* pointContacts
+	*
+	* builds a manifold with a single point, the deepest point of a circle
+	* or the average of the support points of other shapes
+	*
+	* @param AdvancedCollision& partial - the collision to add the manifold to
+	* @returns void
+	*/
+	void pointContacts(AdvancedCollision& partial);
+
 	//as per the singleton structure
 
 	/*
 	* CollisionSolver()
-	* default constructor
+	* default constructor - fills the dispatch table
 	*/
-	CollisionSolver() {};
+	CollisionSolver();
 
 	/*
 	* CollisionSolver()
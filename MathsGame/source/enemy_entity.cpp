@@ -37,6 +37,15 @@ EnemyEntity::EnemyEntity(Application2D* appPtr, Path* path, PlayerEntity* player
 	target = player;
 }
 
+//the path would never be collected
+EnemyEntity::~EnemyEntity()
+{
+	if (pathTicket != PATH_TICKET_NONE && pathService != nullptr)
+	{
+		pathService->cancel(pathTicket);
+	}
+}
+
 //gets called when the entity is involved in a collision
 void EnemyEntity::collisionCallBack(BaseEntity * other)
 {
@@ -56,39 +65,59 @@ void EnemyEntity::update(float deltaTime, Application2D* appPtr)
 	playerLine->layer = 0b0100;
 	bool canSeePlayer = appPtr->world.testCollider(playerLine).size() > 0;
 
-	Vector2 relative;
+	//head straight for the player until there is a path to follow
+	Vector2 relative = target->collider->transform.translation - collider->transform.translation;
 
+	//follow the shared flow field towards the player's closest node
+	if (pathing == EnemyPathing::FLOW_FIELD && closestNode != nullptr && target->closestNode != nullptr)
+	{
+		FlowField& field = appPtr->flowField;
+
+		//only rebuilds if the player has moved to another node
+		field.setGoal(target->closestNode);
+
+		//the waypoint is either the closest node or the next one after it, anything else means the enemy got pushed off the route.
+		//the goal has no next node, so an enemy without a waypoint that starts on the goal needs checking on its own
+		if (flowWaypoint == nullptr || (flowWaypoint != closestNode && flowWaypoint != field.getNextHop(closestNode)))
+		{
+			flowWaypoint = closestNode;
+		}
+
+		//move on to the next node once the waypoint is reached, the goal has no next node
+		if ((flowWaypoint->position - collider->transform.translation).sqrMagnitude() <= nodeEpsilon * nodeEpsilon &&
+			field.getNextHop(flowWaypoint) != nullptr)
+		{
+			flowWaypoint = field.getNextHop(flowWaypoint);
+		}
+
+		relative = (flowWaypoint->position - collider->transform.translation);
+	}
 	//get a path from the enemy to the player if the both know where they are
-	if (closestNode != nullptr && target->closestNode != nullptr)
+	else if (closestNode != nullptr && target->closestNode != nullptr)
 	{
-		//calculate a path if there isn't one yet
-		if (pathList.size() == 0)
+		//pick up the path asked for on an earlier frame
+		if (pathTicket != PATH_TICKET_NONE && appPtr->pathService.collect(pathTicket, pathList))
 		{
-			pathList = appPtr->path.calculatePath(closestNode, target->closestNode);
+			pathTicket = PATH_TICKET_NONE;
 		}
 
-		//if the end point of the calculated path is the player's closest node
-		if (pathList[0]->position == target->closestNode->position)
+		//there is no path, or it leads to where the player used to be. ask for a new one,
+		//the old one is followed until it arrives
+		if ((pathList.size() == 0 || pathList[0] != target->closestNode) && pathTicket == PATH_TICKET_NONE)
 		{
-			//is the relative distance from the enemy to the next node smaller than epsilon
-			if ((pathList[pathList.size() - 1]->position - collider->transform.translation).sqrMagnitude() <= nodeEpsilon * nodeEpsilon)
-			{
-				pathList.pop_back();
-			}
-
-			if (pathList.size() == 0 && !canSeePlayer)
-			{
-				pathList = appPtr->path.calculatePath(closestNode, target->closestNode);
-			}
-
-			if (pathList.size() > 0)
-			{
-				relative = (pathList[pathList.size() - 1]->position - collider->transform.translation);
-			}
+			pathService = &appPtr->pathService;
+			pathTicket = pathService->submit(closestNode, target->closestNode);
 		}
-		else //recalculate path
+
+		//is the relative distance from the enemy to the next node smaller than epsilon
+		if (pathList.size() > 0 && (pathList[pathList.size() - 1]->position - collider->transform.translation).sqrMagnitude() <= nodeEpsilon * nodeEpsilon)
+		{
+			pathList.pop_back();
+		}
+
+		if (pathList.size() > 0)
 		{
-			pathList = appPtr->path.calculatePath(closestNode, target->closestNode);
+			relative = (pathList[pathList.size() - 1]->position - collider->transform.translation);
 		}
 	}
 
@@ -147,10 +176,9 @@ void EnemyEntity::render(Application2D* appPtr)
 {
 	//the rotation occurs from the top-left corner
 	//use another matrix to force entities to rotate from the centre
-	Matrix3 correction = Matrix3{};
-	correction.identity();
+	Affine2 correction = Affine2{};
 	correction[2][0] = enemyTexture->getWidth() / -2.0f;
 	correction[2][1] = enemyTexture->getHeight() / -2.0f;
 
-	appPtr->m_2dRenderer->drawSpriteTransformed3x3(enemyTexture, collider->transform.globalTransform * correction, 0.0f, 0.0f, 0, 0.0f, 0.0f);
+	appPtr->m_2dRenderer->drawSpriteTransformed3x3(enemyTexture, Matrix3(appPtr->world.renderTransform(collider->transform) * correction), 0.0f, 0.0f, 0, 0.0f, 0.0f);
 }
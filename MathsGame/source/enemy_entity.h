@@ -1,11 +1,20 @@
 #pragma once
 #include "base_entity.h"
 #include "player_entity.h"
+#include "path_service.h"
+#include "flow_field.h"
 #include "Texture.h"
 
 //forward declaration
 class Application2D;
 
+//how an enemy finds its way to its target
+enum class EnemyPathing
+{
+	SERVICE, //asks the application's PathService for a path of its own
+	FLOW_FIELD, //follows the application's flow field, one search is shared by every enemy chasing the same node
+};
+
 /*
 * class EnemyEntity
 * child class of BaseEntity
@@ -28,6 +37,11 @@ public:
 	float nodeEpsilon = 50.0f; //how close the enemy has to be to a pathfinding node before it moves towards the next one
 	Node* closestNode; //closest pathfinding node (position) to the entity can be moved directly
 	std::vector<Node*> pathList; //array of vectors to follow to get to the player
+	int pathTicket = PATH_TICKET_NONE; //ticket of the path asked for from the application's PathService, PATH_TICKET_NONE if it isn't waiting on one
+	PathService* pathService = nullptr; //the service pathTicket came from, the ticket is cancelled if the enemy is deleted before collecting it
+
+	EnemyPathing pathing = EnemyPathing::FLOW_FIELD; //how the enemy finds its way to the target
+	Node* flowWaypoint = nullptr; //the node being moved towards while following the flow field
 
 	aie::Texture * enemyTexture; //texture used to draw the enemy
 
@@ -49,9 +63,9 @@ public:
 
 	/*
 	* ~EnemyEntity()
-	* default destructor
+	* destructor, cancels the path the enemy is waiting on
 	*/
-	~EnemyEntity() {};
+	~EnemyEntity();
 
 	/*
 	* collisionCallBack
@@ -82,6 +82,10 @@ std::vector<EnemyEntity*> Factory::createMultipleEnemies(Path * path, PlayerEnti
 ProjectileEntity * Factory::createProjectile(ProjectileType projectileType)
 {
 	ProjectileEntity* newProj = new ProjectileEntity{appPtr, projectileType};
+
+	//projectiles are fast enough to pass through a wall in one step
+	newProj->bullet = true;
+
 	return newProj;
 }
 
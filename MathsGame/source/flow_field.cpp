@@ -0,0 +1,44 @@
+#include "flow_field.h"
+
+//change the goal if it is different
+void FlowField::setGoal(Node * newGoal)
+{
+	if (newGoal == goal && nextHops.size() == path->nodes.size())
+	{
+		return;
+	}
+
+	goal = newGoal;
+
+	rebuild();
+}
+
+//search from the goal and keep each node's next hop
+void FlowField::rebuild()
+{
+	rebuilds++;
+
+	size_t nodeSize = path->nodes.size();
+
+	nextHops.assign(nodeSize, nullptr);
+	costs.assign(nodeSize, std::numeric_limits<float>::max());
+
+	if (goal == nullptr)
+	{
+		return;
+	}
+
+	path->calculateField(goal, search);
+
+	for (size_t i = 0; i < nodeSize; i++)
+	{
+		//nodes the search never closed can't reach the goal
+		if (search.stamps[i] != search.generation || search.heapPositions[i] != PATH_CLOSED)
+		{
+			continue;
+		}
+
+		nextHops[i] = search.parents[i];
+		costs[i] = search.costs[i];
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <vector>
+#include "path.h"
+
+/*
+* class FlowField
+*
+* the next node on the shortest route to one goal node, for every node in a Path.
+* any number of entities heading for the same goal can read their next node from it
+* instead of each searching for a path. it is only rebuilt when the goal changes
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class FlowField
+{
+public:
+
+	Path* path = nullptr; //the graph the field covers
+
+	Node* goal = nullptr; //the node every route leads to
+	std::vector<Node*> nextHops; //the next node on the route from each node, indexed by Node::id. nullptr for the goal and nodes that can't reach it
+	std::vector<float> costs; //the cost of the route from each node, indexed by Node::id
+
+	size_t rebuilds = 0; //how many times the field has been built
+
+	/*
+	* FlowField()
+	* default constructor
+	*/
+	FlowField() {};
+
+	/*
+	* ~FlowField()
+	* default destructor
+	*/
+	~FlowField() {};
+
+	/*
+	* setGoal
+	*
+	* points the field at a goal, the field is only rebuilt if the goal changed
+	*
+	* @param Node* newGoal - the node the routes should lead to
+	* @returns void
+	*/
+	void setGoal(Node* newGoal);
+
+	/*
+	* getNextHop
+	*
+	* gets the next node on the route from a node to the goal
+	*
+	* @param Node* node - the node to start from
+	* @returns Node* - the node to move to, nullptr at the goal or if the goal can't be reached
+	*/
+	Node* getNextHop(Node* node) { return nextHops[node->id]; };
+
+	/*
+	* rebuild
+	*
+	* searches outwards from the goal and stores the next node of every route
+	*
+	* @returns void
+	*/
+	void rebuild();
+
+protected:
+
+	PathSearch search; //state of the search, kept between builds so its memory is reused
+};
@@ -12,34 +12,21 @@ Line::Line(Vector2 _start, Vector2 _end)
 }
 
 //gets the projection axis of the line
-std::vector<Vector2> Line::getAxes(Collider& other)
+void Line::getAxes(Collider& other, AxisBuffer& axes)
 {
+	updateWorldGeometry();
 
-	//get the global transformation matrix without translation
-	Matrix3 globalInvTrans = transform.globalTransform;
-	globalInvTrans[2][0] = 0;
-	globalInvTrans[2][1] = 0;
-
-	//get the two ends by applying transformation
-	Vector2 startTra = (Vector3(start.x, start.y, 1) * globalInvTrans).GetXY();
-	Vector2 endTra = (Vector3(end.x, end.y, 1) * globalInvTrans).GetXY();
-
-	std::vector<Vector2> axes;
-
-	//adds the relative 'normal' vector from the start to the end of the line
-	Vector2 normal = (endTra - startTra).normalised().normal();
-	axes.push_back(normal);
-
-	return axes;
+	axes.push(worldAxes[0]);
 }
 
 //get the smallest and largest dot products of the circle to the axis
 Range Line::project(Vector2 axis)
 {
+	updateWorldGeometry();
 
-	//get the two ends by applying transformation
-	Vector2 startTra = (Vector3(start.x, start.y, 1) * transform.globalTransform).GetXY();
-	Vector2 endTra = (Vector3(end.x, end.y, 1) * transform.globalTransform).GetXY();
+	//the two ends with the transformation applied
+	Vector2 startTra = worldPoints[0];
+	Vector2 endTra = worldPoints[1];
 
 	Vector2 axisNorm = axis.normalised();
 
@@ -105,21 +92,21 @@ float Line::momentOfInertia(float mass)
 	return mass * bestSqr;
 }
 
-//create an aabb that encapsulates the shape
-void Line::generateHull()
+//transform the ends, normal and hull into world space
+void Line::calculateWorldGeometry()
 {
-	if (hull != nullptr)
-	{
-		delete hull;
-	}
+	//get the two ends by applying transformation as one batch
+	worldPoints.resize(2);
+	worldPoints[0] = start;
+	worldPoints[1] = end;
 
-	Range xRange = project(Vector2{ 1,0 });
-	Range yRange = project(Vector2{ 0,1 });
+	transform.globalTransform.transformPoints(worldPoints.data(), worldPoints.data(), 2);
 
-	Vector2 min = Vector2{ xRange.min, yRange.min };
-	Vector2 max = Vector2{ xRange.max, yRange.max };
+	//the relative 'normal' vector from the start to the end of the line
+	worldAxes.resize(1);
+	worldAxes[0] = (worldPoints[1] - worldPoints[0]).normalised().normal();
 
-	hull = new AABB{ min, max };
+	fitHullToPoints();
 }
 
 //render the line
@@ -127,8 +114,8 @@ void Line::render(Application2D* app)
 {
 
 	//transform the start and end points
-	Vector2 startTra = (transform.globalTransform * Vector3(start.x, start.y, 1)).GetXY();
-	Vector2 endTra = (transform.globalTransform * Vector3(end.x, end.y, 1)).GetXY();
+	Vector2 startTra = transform.globalTransform.transformPoint(Vector2{ start.x, start.y });
+	Vector2 endTra = transform.globalTransform.transformPoint(Vector2{ end.x, end.y });
 
 	app->m_2dRenderer->drawLine(startTra.x, startTra.y, endTra.x, endTra.y, 1.0f, 0.0f);
 }
@@ -6,4 +6,5 @@
 #include "Vector4.h"
 #include "Matrix2.h"
 #include "Matrix3.h"
-#include "Matrix4.h"
\ No newline at end of file
+#include "Matrix4.h"
+#include "Affine2.h"
\ No newline at end of file
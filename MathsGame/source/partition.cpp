@@ -1,4 +1,6 @@
 #include "partition.h"
+#include <limits>
+#include <cmath>
 #include "AABB.h"
 #include "physics.h"
 #include "factory.h"
@@ -6,7 +8,8 @@
 //constructor
 SpatialPartition::SpatialPartition()
 {
-
+	//one narrowphase thread per hardware thread
+	narrowphaseThreads.setThreadCount(0);
 }
 
 //destructor
@@ -20,223 +23,495 @@ SpatialPartition::~SpatialPartition()
 	{
 		delete entities[i].entity;
 	}
+
+	size_t staticSize = staticEntities.size();
+
+	for (size_t i = 0; i < staticSize; i++)
+	{
+		delete staticEntities[i];
+	}
 }
 
 //initialise the partition
 void SpatialPartition::initialisePartition()
 {
-	size_t iSize = nodes.size();
+	size_t nodeCount = (size_t)(iLength * jLength);
+
+	//every node gets a fixed row of slots in one array, all empty
+	nodeSlots.assign(nodeCount * PARTITION_NODE_CAPACITY, nullptr);
+	nodeCounts.assign(nodeCount, 0);
+	nodeOverflow.clear();
+	overflowHeads.assign(nodeCount, -1);
+	overflowFree = -1;
+
+	//the static layer starts off empty
+	staticOffsets.assign(nodeCount + 1, 0);
+	staticNodes.clear();
+}
+
+//get the first and last node the hull intersects
+bool SpatialPartition::getNodeRange(AABB* hull, index2D& start, index2D& end)
+{
+	//get the indices that the collider intersects
+	float xStart = hull->min.x - origin.x;
+	xStart /= nodeSize;
+
+	float xEnd = hull->max.x - origin.x;
+	xEnd /= nodeSize;
+
+	float yStart = hull->min.y - origin.y;
+	yStart /= nodeSize;
+
+	float yEnd = hull->max.y - origin.y;
+	yEnd /= nodeSize;
+
+	//round the iterators down
+	xStart = floorf(xStart);
+	xEnd = ceilf(xEnd);
+
+	yStart = floorf(yStart);
+	yEnd = ceilf(yEnd);
+
+	float iLast = (float)(iLength - 1);
+	float jLast = (float)(jLength - 1);
+
+	//does the hull reach into the partitioned region at all
+	bool intersects = yEnd >= 0 && yStart <= iLast && xEnd >= 0 && xStart <= jLast;
+
+	//clamp the range to the partitioned region, a hull past an edge gets the nodes along that edge.
+	//clamping keeps the order of the indices, so two hulls that overlap always share a node
+	start.i = (int)(yStart < 0 ? 0 : (yStart > iLast ? iLast : yStart));
+	start.j = (int)(xStart < 0 ? 0 : (xStart > jLast ? jLast : xStart));
+
+	end.i = (int)(yEnd < 0 ? 0 : (yEnd > iLast ? iLast : yEnd));
+	end.j = (int)(xEnd < 0 ? 0 : (xEnd > jLast ? jLast : xEnd));
+
+	return intersects;
+}
+
+//only colliders of a reasonable size that reach into the region are kept in the grid
+bool SpatialPartition::fitsGrid(AABB* hull, index2D& start, index2D& end)
+{
+	//everything goes in the tree
+	if (broadphase == BroadphaseType::TREE)
+	{
+		return false;
+	}
+
+	float xSize = hull->max.x - hull->min.x;
+	float ySize = hull->max.y - hull->min.y;
+
+	//the collider is too big to be added to the grid
+	if (xSize > nodeSize * 6.0f || ySize > nodeSize * 6.0f)
+	{
+		return false;
+	}
+
+	return getNodeRange(hull, start, end);
+}
+
+//add an entity to a node, spilling into the overflow once the node's slots are full
+void SpatialPartition::addToNode(int node, BaseEntity* entity)
+{
+	int count = nodeCounts[node];
 
-	for (size_t i = 0; i < iSize; i++)
+	if (count < PARTITION_NODE_CAPACITY)
 	{
-		size_t jSize = nodes[i].size();
+		nodeSlots[node * PARTITION_NODE_CAPACITY + count] = entity;
+	}
+	else
+	{
+		//reuse a released entry if there is one
+		int entry = overflowFree;
 
-		for (size_t j = 0; j < jSize; j++)
+		if (entry == -1)
+		{
+			entry = (int)nodeOverflow.size();
+			nodeOverflow.push_back(SpatialPartitionOverflow{});
+		}
+		else
 		{
-			//erase each array of colliders (2 dimensions down)
-			nodes[i][j].erase(nodes[i][j].begin(), nodes[i][j].end());
+			overflowFree = nodeOverflow[entry].next;
 		}
 
-		//erase each array 1 dimension down
-		nodes[i].erase(nodes[i].begin(), nodes[i].end());
+		nodeOverflow[entry] = SpatialPartitionOverflow{ node, entity, overflowHeads[node] };
+		overflowHeads[node] = entry;
 	}
 
-	//erase each array
-	nodes.erase(nodes.begin(), nodes.end());
+	nodeCounts[node]++;
+}
 
-	size_t newISize = iLength;
-	size_t newJSize = jLength;
+//remove an entity from a node, the hole is filled with the node's last entity
+void SpatialPartition::removeFromNode(int node, BaseEntity* entity)
+{
+	int count = nodeCounts[node];
+	int slotCount = count < PARTITION_NODE_CAPACITY ? count : PARTITION_NODE_CAPACITY;
+	BaseEntity** slots = &nodeSlots[node * PARTITION_NODE_CAPACITY];
 
-	for (size_t i = 0; i < newISize; i++)
+	for (int i = 0; i < slotCount; i++)
 	{
-		std::vector<std::vector<BaseEntity*>> node2D;
+		if (slots[i] != entity)
+		{
+			continue;
+		}
+
+		if (count > PARTITION_NODE_CAPACITY)
+		{
+			//move one of the node's overflowing entities into the slot
+			int head = overflowHeads[node];
+
+			slots[i] = nodeOverflow[head].entity;
+			releaseOverflow(node, -1, head);
+		}
+		else
+		{
+			slots[i] = slots[slotCount - 1];
+			slots[slotCount - 1] = nullptr;
+		}
+
+		nodeCounts[node]--;
+		return;
+	}
 
-		nodes.push_back(node2D);
+	//not in the slots, look in the node's overflow
+	int previous = -1;
 
-		for (size_t j = 0; j < newJSize; j++)
+	for (int entry = overflowHeads[node]; entry != -1; entry = nodeOverflow[entry].next)
+	{
+		if (nodeOverflow[entry].entity == entity)
 		{
-			std::vector<BaseEntity*> node1D;
-			nodes[i].push_back(node1D);
+			releaseOverflow(node, previous, entry);
+			nodeCounts[node]--;
+			return;
 		}
+
+		previous = entry;
 	}
 }
 
-//add collider to partition
-bool SpatialPartition::registerCollider(BaseEntity* entity, bool full)
+//take an entry out of its node's chain and put it at the front of the unused entries
+void SpatialPartition::releaseOverflow(int node, int previous, int entry)
 {
-	entity->collider->transform.updateGlobalTransform();
-	entity->collider->transform.updateChildren();
+	int next = nodeOverflow[entry].next;
 
-	if (entity->type == EntityType::SEAT)
+	if (previous == -1)
 	{
-		int a = 0;
+		overflowHeads[node] = next;
 	}
+	else
+	{
+		nodeOverflow[previous].next = next;
+	}
+
+	nodeOverflow[entry] = SpatialPartitionOverflow{ -1, nullptr, overflowFree };
+	overflowFree = entry;
+}
 
+//add collider to partition
+bool SpatialPartition::registerCollider(BaseEntity* entity, bool full)
+{
+	entity->collider->transform.updateGlobalTransform();
+	entity->collider->transform.updateChildren();
 
 	entity->collider->generateHull();
 	AABB* hull = entity->collider->hull;
 
-	Range xRange = Range{};
-	Range yRange = Range{};
+	SpatialPartitionBodyPair partEntityPair;
 
-	xRange.min = hull->min.x;
-	xRange.max = hull->max.x;
+	partEntityPair.entity = entity;
 
-	yRange.min = hull->min.y;
-	yRange.max = hull->max.y;
+	index2D start = index2D{};
+	index2D end = index2D{};
 
+	entity->partitioned = fitsGrid(hull, start, end);
+	entity->nodeStart = start;
+	entity->nodeEnd = end;
 
-	float xSize = xRange.max - xRange.min;
-	float ySize = yRange.max - yRange.min;
+	//colliders the grid can't hold go in the tree instead
+	if (!entity->partitioned)
+	{
+		entity->treeProxy = tree.createProxy(entity, hull->min, hull->max);
+	}
 
-	//the collider is too big to be added to the partition
-	if (xSize > nodeSize * 6.0f || ySize > nodeSize * 6.0f)
+	if (broadphase == BroadphaseType::SWEEP)
 	{
-		return false;
+		entity->sweepProxy = sweep.addProxy(entity);
 	}
 
-	SpatialPartitionBodyPair partEntityPair;
+	//add the collider to every node it intersects
+	if (entity->partitioned)
+	{
+		for (int i = start.i; i <= end.i; i++)
+		{
+			for (int j = start.j; j <= end.j; j++)
+			{
+				addToNode(i * jLength + j, entity);
+			}
+		}
+	}
 
-	partEntityPair.entity = entity;
+	if (!full)
+	{
+		return true;
+	}
 
-	//get the indices that the collider intersects
-	float xStart = xRange.min - origin.x;
-	xStart /= nodeSize;
+	entities.push_back(partEntityPair);
 
-	float xEnd = xRange.max - origin.x;
-	xEnd /= nodeSize;
+	return true;
+}
 
-	float yStart = yRange.min - origin.y;
-	yStart /= nodeSize;
+//pack the entities that never move into the static layer
+void SpatialPartition::buildStaticLayer(std::vector<BaseEntity*>& statics)
+{
+	size_t nodeCount = (size_t)(iLength * jLength);
 
-	float yEnd = yRange.max - origin.y;
-	yEnd /= nodeSize;
+	//the layer is repacked with the entities from any earlier build as well
+	staticEntities.insert(staticEntities.end(), statics.begin(), statics.end());
+	size_t staticSize = staticEntities.size();
 
-	std::vector<index2D> intersections;
+	//count how many entities are in each node
+	std::vector<int> counts(nodeCount, 0);
 
-	//round the iterators down
-	xStart = floorf(xStart);
-	xEnd = ceilf(xEnd);
+	for (size_t k = 0; k < staticSize; k++)
+	{
+		BaseEntity* entity = staticEntities[k];
 
-	yStart = floorf(yStart);
-	yEnd = ceilf(yEnd);
+		entity->collider->transform.updateGlobalTransform();
+		entity->collider->transform.updateChildren();
+		entity->collider->generateHull();
 
-	//convert the ranges to index loops
-	for (int i = (int)yStart; i <= (int)yEnd; i++)
-	{
-		for (int j = (int)xStart; j <= (int)xEnd; j++)
+		entity->staticLayer = true;
+
+		//already in the tree from an earlier build
+		if (entity->treeProxy != AABB_TREE_NULL)
+		{
+			continue;
+		}
+
+		AABB* hull = entity->collider->hull;
+		entity->partitioned = fitsGrid(hull, entity->nodeStart, entity->nodeEnd);
+
+		//colliders the grid can't hold go in the tree instead
+		if (!entity->partitioned)
+		{
+			entity->treeProxy = tree.createProxy(entity, hull->min, hull->max);
+			continue;
+		}
+
+		for (int i = entity->nodeStart.i; i <= entity->nodeEnd.i; i++)
 		{
-			//test if the index is inside the partioned region
-			if ((j >= 0 && j < jLength) && (i >= 0 && i < iLength))
+			for (int j = entity->nodeStart.j; j <= entity->nodeEnd.j; j++)
 			{
-				index2D newIndex = index2D{};
-				newIndex.i = i;
-				newIndex.j = j;
+				counts[i * jLength + j]++;
+			}
+		}
+	}
+
+	//only the new entities need adding to the sweep
+	if (broadphase == BroadphaseType::SWEEP)
+	{
+		size_t newSize = statics.size();
 
-				intersections.push_back(newIndex);
+		for (size_t k = 0; k < newSize; k++)
+		{
+			if (statics[k]->sweepProxy == SWEEP_NULL)
+			{
+				statics[k]->sweepProxy = sweep.addProxy(statics[k]);
 			}
 		}
 	}
 
-	size_t interSize = intersections.size();
+	//turn the counts into the start of each node
+	staticOffsets.assign(nodeCount + 1, 0);
 
-	//add the collider to the 2D partition array
-	for (size_t i = 0; i < interSize; i++)
+	for (size_t n = 0; n < nodeCount; n++)
 	{
-		nodes[intersections[i].i][intersections[i].j].push_back(entity);
+		staticOffsets[n + 1] = staticOffsets[n] + counts[n];
 	}
 
-	if (!full)
+	//fill the nodes, counts is reused as each node's write position
+	staticNodes.assign(staticOffsets[nodeCount], nullptr);
+
+	for (size_t n = 0; n < nodeCount; n++)
 	{
-		return true;
+		counts[n] = staticOffsets[n];
 	}
 
-	entities.push_back(partEntityPair);
+	for (size_t k = 0; k < staticSize; k++)
+	{
+		BaseEntity* entity = staticEntities[k];
 
-	return true;
+		if (!entity->partitioned)
+		{
+			continue;
+		}
+
+		for (int i = entity->nodeStart.i; i <= entity->nodeEnd.i; i++)
+		{
+			for (int j = entity->nodeStart.j; j <= entity->nodeEnd.j; j++)
+			{
+				staticNodes[counts[i * jLength + j]++] = entity;
+			}
+		}
+	}
 }
 
-//remove collider from partition
-void SpatialPartition::removeCollider(BaseEntity** entitydPtr, bool full, int id)
+//true if node (i, j) is inside the block of nodes from start to end
+static bool inBlock(int i, int j, index2D start, index2D end)
 {
-	BaseEntity* entityPtr = *entitydPtr;
-
-	entityPtr->collider->generateHull();
-	AABB* hull = entityPtr->collider->hull;
-
-	Range xRange = Range{};
-	Range yRange = Range{};
+	return i >= start.i && i <= end.i && j >= start.j && j <= end.j;
+}
 
-	xRange.min = hull->min.x;
-	xRange.max = hull->max.x;
+//update the nodes of an entity that moved, only the nodes it entered or left are touched
+void SpatialPartition::moveCollider(BaseEntity* entity)
+{
+	entity->collider->generateHull();
+	AABB* hull = entity->collider->hull;
 
-	yRange.min = hull->min.y;
-	yRange.max = hull->max.y;
+	index2D start = index2D{};
+	index2D end = index2D{};
 
-	float xSize = xRange.max - xRange.min;
-	float ySize = yRange.max - yRange.min;
+	//a collider that grew too big or left the region isn't in any node
+	bool inside = fitsGrid(hull, start, end);
 
-	SpatialPartitionBodyPair partEntityPair;
+	if (!inside)
+	{
+		//the tree only changes if the hull left its leaf's fattened box
+		if (entity->treeProxy == AABB_TREE_NULL)
+		{
+			entity->treeProxy = tree.createProxy(entity, hull->min, hull->max);
+		}
+		else
+		{
+			tree.moveProxy(entity->treeProxy, hull->min, hull->max);
+		}
+	}
+	else if (entity->treeProxy != AABB_TREE_NULL)
+	{
+		//back inside the grid
+		tree.destroyProxy(entity->treeProxy);
+		entity->treeProxy = AABB_TREE_NULL;
+	}
 
-	partEntityPair.entity = entityPtr;
+	index2D oldStart = entity->nodeStart;
+	index2D oldEnd = entity->nodeEnd;
+	bool wasInside = entity->partitioned;
 
-	//get the indices that the collider intersects
-	float xStart = xRange.min - origin.x;
-	xStart /= nodeSize;
+	//the entity is still in the same nodes, nothing to do
+	if (inside == wasInside && (!inside || (start.i == oldStart.i && start.j == oldStart.j && end.i == oldEnd.i && end.j == oldEnd.j)))
+	{
+		return;
+	}
 
-	float xEnd = xRange.max - origin.x;
-	xEnd /= nodeSize;
+	//leave the nodes that aren't in the new block
+	if (wasInside)
+	{
+		for (int i = oldStart.i; i <= oldEnd.i; i++)
+		{
+			for (int j = oldStart.j; j <= oldEnd.j; j++)
+			{
+				if (!inside || !inBlock(i, j, start, end))
+				{
+					removeFromNode(i * jLength + j, entity);
+				}
+			}
+		}
+	}
 
-	float yStart = yRange.min - origin.y;
-	yStart /= nodeSize;
+	//enter the nodes that weren't in the old block
+	if (inside)
+	{
+		for (int i = start.i; i <= end.i; i++)
+		{
+			for (int j = start.j; j <= end.j; j++)
+			{
+				if (!wasInside || !inBlock(i, j, oldStart, oldEnd))
+				{
+					addToNode(i * jLength + j, entity);
+				}
+			}
+		}
+	}
 
-	float yEnd = yRange.max - origin.y;
-	yEnd /= nodeSize;
+	entity->partitioned = inside;
+	entity->nodeStart = start;
+	entity->nodeEnd = end;
+}
 
-	std::vector<index2D> intersections;
+//remove collider from partition
+void SpatialPartition::removeCollider(BaseEntity** entitydPtr, bool full, int id)
+{
+	BaseEntity* entityPtr = *entitydPtr;
 
-	//round the iterators down
-	xStart = floorf(xStart);
-	xEnd = ceilf(xEnd);
+	if (entityPtr->treeProxy != AABB_TREE_NULL)
+	{
+		tree.destroyProxy(entityPtr->treeProxy);
+		entityPtr->treeProxy = AABB_TREE_NULL;
+	}
 
-	yStart = floorf(yStart);
-	yEnd = ceilf(yEnd);
+	if (entityPtr->sweepProxy != SWEEP_NULL)
+	{
+		sweep.removeProxy(entityPtr->sweepProxy);
+		entityPtr->sweepProxy = SWEEP_NULL;
+	}
 
-	//convert the ranges to index loops
-	for (int i = (int)yStart; i <= (int)yEnd; i++)
+	//the static layer is never repacked, the entity is just blanked out of its nodes
+	if (entityPtr->staticLayer)
 	{
-		for (int j = (int)xStart; j <= (int)xEnd; j++)
+		if (entityPtr->partitioned)
 		{
-			//test if the index is inside the partioned region
-			if ((j >= 0 && j < jLength) && (i >= 0 && i < iLength))
+			for (int i = entityPtr->nodeStart.i; i <= entityPtr->nodeEnd.i; i++)
 			{
-				index2D newIndex = index2D{};
-				newIndex.i = i;
-				newIndex.j = j;
+				for (int j = entityPtr->nodeStart.j; j <= entityPtr->nodeEnd.j; j++)
+				{
+					int node = i * jLength + j;
+
+					for (int k = staticOffsets[node]; k < staticOffsets[node + 1]; k++)
+					{
+						if (staticNodes[k] == entityPtr)
+						{
+							staticNodes[k] = nullptr;
+						}
+					}
+				}
+			}
+
+			entityPtr->partitioned = false;
+		}
+
+		if (!full)
+		{
+			return;
+		}
+
+		size_t staticSize = staticEntities.size();
 
-				intersections.push_back(newIndex);
+		for (size_t i = 0; i < staticSize; i++)
+		{
+			if (entityPtr == staticEntities[i])
+			{
+				staticEntities.erase(staticEntities.begin() + i);
+				break;
 			}
 		}
-	}
 
-	size_t interSize = intersections.size();
+		delete entityPtr;
+		(*entitydPtr) = nullptr;
+		return;
+	}
 
-	//remove the collider from the 2D partition array
-	for (size_t i = 0; i < interSize; i++)
+	//remove the collider from every node it was registered in
+	if (entityPtr->partitioned)
 	{
-		size_t searchSize = nodes[intersections[i].i][intersections[i].j].size();
-		std::vector<BaseEntity*> & node = nodes[intersections[i].i][intersections[i].j];
-
-		for (size_t j = 0; j < searchSize; j++)
+		for (int i = entityPtr->nodeStart.i; i <= entityPtr->nodeEnd.i; i++)
 		{
-			//find the entity in the array and erase
-			if (entityPtr == node[j])
+			for (int j = entityPtr->nodeStart.j; j <= entityPtr->nodeEnd.j; j++)
 			{
-				node.erase(node.begin() + j);
-				searchSize--;
+				removeFromNode(i * jLength + j, entityPtr);
 			}
 		}
 
+		entityPtr->partitioned = false;
 	}
 
 	if (!full)
@@ -299,170 +574,179 @@ std::vector<BaseEntity*> SpatialPartition::testCollider(Collider * collider)
 	return collidees;
 }
 
-//get the potential entities that could be colliding with the given collider
-std::vector<BaseEntity*> SpatialPartition::getNeighbours(Collider * collider)
+//collect every entity in the nodes the hull intersects
+void SpatialPartition::gatherNeighbours(AABB* hull, Collider* excluded, std::vector<BaseEntity*>& neighbours)
 {
-	collider->generateHull();
-	AABB* hull = collider->hull;
-
-	Range xRange = Range{};
-	Range yRange = Range{};
+	//colliders that are kept in the tree
+	tree.query(hull->min, hull->max, excluded, neighbours);
 
-	xRange.min = hull->min.x;
-	xRange.max = hull->max.x;
-
-	yRange.min = hull->min.y;
-	yRange.max = hull->max.y;
-
-
-	float xSize = xRange.max - xRange.min;
-	float ySize = yRange.max - yRange.min;
+	if (broadphase == BroadphaseType::TREE)
+	{
+		return;
+	}
 
-	//get the indices that the collider intersects
-	float xStart = xRange.min - origin.x;
-	xStart /= nodeSize;
+	index2D start;
+	index2D end;
 
-	float xEnd = xRange.max - origin.x;
-	xEnd /= nodeSize;
+	//a hull outside of the region still searches the nodes along the nearest edge,
+	//colliders hanging over that edge are stored there
+	getNodeRange(hull, start, end);
 
-	float yStart = yRange.min - origin.y;
-	yStart /= nodeSize;
+	for (int i = start.i; i <= end.i; i++)
+	{
+		for (int j = start.j; j <= end.j; j++)
+		{
+			int node = i * jLength + j;
 
-	float yEnd = yRange.max - origin.y;
-	yEnd /= nodeSize;
+			//add everything from the static layer, blanked out entries were removed
+			for (int k = staticOffsets[node]; k < staticOffsets[node + 1]; k++)
+			{
+				BaseEntity* neighbour = staticNodes[k];
 
-	std::vector<index2D> intersections;
+				if (neighbour != nullptr && neighbour->collider != excluded)
+				{
+					neighbours.push_back(neighbour);
+				}
+			}
 
-	//round the iterators down
-	xStart = floorf(xStart);
-	xEnd = ceilf(xEnd);
+			int count = nodeCounts[node];
+			int slotCount = count < PARTITION_NODE_CAPACITY ? count : PARTITION_NODE_CAPACITY;
+			BaseEntity** slots = &nodeSlots[node * PARTITION_NODE_CAPACITY];
 
-	yStart = floorf(yStart);
-	yEnd = ceilf(yEnd);
+			//add every collider from the node
+			for (int k = 0; k < slotCount; k++)
+			{
+				//don't make a shape test collisions against itself
+				if (slots[k]->collider != excluded)
+				{
+					neighbours.push_back(slots[k]);
+				}
+			}
 
-	//convert the ranges to index loops
-	for (int i = (int)yStart; i <= (int)yEnd; i++)
-	{
-		for (int j = (int)xStart; j <= (int)xEnd; j++)
-		{
-			//test if the index is inside the partioned region
-			if ((j >= 0 && j < jLength) && (i >= 0 && i < iLength))
+			if (count <= PARTITION_NODE_CAPACITY)
 			{
-				index2D newIndex = index2D{};
-				newIndex.i = i;
-				newIndex.j = j;
+				continue;
+			}
 
-				intersections.push_back(newIndex);
+			//the rest of the node is in its overflow chain
+			for (int entry = overflowHeads[node]; entry != -1; entry = nodeOverflow[entry].next)
+			{
+				if (nodeOverflow[entry].entity->collider != excluded)
+				{
+					neighbours.push_back(nodeOverflow[entry].entity);
+				}
 			}
 		}
 	}
+}
 
-	size_t interSize = intersections.size();
-	
-	std::vector<BaseEntity*> neighbours;
-
-	//remove the collider to the 2D partition array
-	for (size_t i = 0; i < interSize; i++)
+//finds when a hull moving along an axis starts and stops overlapping a range, narrowing the times it overlaps on every axis so far.
+//low and high are the offsets the hull can be moved by and overlap the range, returns false if it never overlaps
+static bool sweepAxis(float motion, float low, float high, float& entry, float& exit)
+{
+	//not moving on this axis, it overlaps the whole time or never
+	if (motion == 0.0f)
 	{
-		std::vector<BaseEntity*>* node = &nodes[intersections[i].i][intersections[i].j];
-		size_t nodeSize = node->size();
+		return low < 0.0f && high > 0.0f;
+	}
 
-		//add every collider from the node
-		for (size_t j = 0; j < nodeSize; j++)
-		{
-			BaseEntity* neighbour = (*node)[j];
+	float start = low / motion;
+	float end = high / motion;
 
-			//don't make a shape test collisions against itself
-			if (neighbour->collider != collider)
-			{
-				neighbours.push_back(neighbour); 
-			}
-		}
+	if (start > end)
+	{
+		float swap = start;
+		start = end;
+		end = swap;
 	}
 
-	return neighbours;
+	entry = start > entry ? start : entry;
+	exit = end < exit ? end : exit;
+
+	return entry < exit;
 }
 
-//get the potential entities that could be colliding with the given entity
-std::vector<BaseEntity*> SpatialPartition::getNeighbours(BaseEntity * entity)
+//sweep a bullet's hull against the static layer
+float SpatialPartition::sweepStatic(BaseEntity* entity, Vector2 motion)
 {
+	stats.bulletSweeps++;
 
 	entity->collider->generateHull();
+
 	AABB* hull = entity->collider->hull;
 
-	Range xRange = Range{};
-	Range yRange = Range{};
+	//the area the hull passes through
+	Vector2 movedMin = hull->min + motion;
+	Vector2 movedMax = hull->max + motion;
 
-	xRange.min = hull->min.x;
-	xRange.max = hull->max.x;
+	AABB path = AABB{ Vector2{ fminf(hull->min.x, movedMin.x), fminf(hull->min.y, movedMin.y) },
+					  Vector2{ fmaxf(hull->max.x, movedMax.x), fmaxf(hull->max.y, movedMax.y) } };
 
-	yRange.min = hull->min.y;
-	yRange.max = hull->max.y;
+	bulletNeighbours.clear();
+	gatherNeighbours(&path, entity->collider, bulletNeighbours);
 
-	float xSize = xRange.max - xRange.min;
-	float ySize = yRange.max - yRange.min;
+	float impact = 1.0f;
 
-	//get the indices that the collider intersects
-	float xStart = xRange.min - origin.x;
-	xStart /= nodeSize;
-
-	float xEnd = xRange.max - origin.x;
-	xEnd /= nodeSize;
-
-	float yStart = yRange.min - origin.y;
-	yStart /= nodeSize;
+	size_t neighboursSize = bulletNeighbours.size();
 
-	float yEnd = yRange.max - origin.y;
-	yEnd /= nodeSize;
+	for (size_t i = 0; i < neighboursSize; i++)
+	{
+		BaseEntity* neighbour = bulletNeighbours[i];
 
-	std::vector<index2D> intersections;
+		//only the static layer is swept against, and only what the bullet could collide with
+		if (!neighbour->staticLayer || !neighbour->colliding || (entity->collider->layer & neighbour->collider->layer) == 0)
+		{
+			continue;
+		}
 
-	//round the iterators down
-	xStart = floorf(xStart);
-	xEnd = ceilf(xEnd);
+		AABB* other = neighbour->collider->hull;
 
-	yStart = floorf(yStart);
-	yEnd = ceilf(yEnd);
+		float entry = 0.0f;
+		float exit = 1.0f;
 
-	//convert the ranges to index loops
-	for (int i = (int)yStart; i <= (int)yEnd; i++)
-	{
-		for (int j = (int)xStart; j <= (int)xEnd; j++)
+		if (!sweepAxis(motion.x, other->min.x - hull->max.x, other->max.x - hull->min.x, entry, exit) ||
+			!sweepAxis(motion.y, other->min.y - hull->max.y, other->max.y - hull->min.y, entry, exit))
 		{
-			//test if the index is inside the partioned region
-			if ((j >= 0 && j < jLength) && (i >= 0 && i < iLength))
-			{
-				index2D newIndex = index2D{};
-				newIndex.i = i;
-				newIndex.j = j;
+			continue;
+		}
 
-				intersections.push_back(newIndex);
-			}
+		//overlapping from the start, the narrowphase already handles it
+		if (entry <= 0.0f)
+		{
+			continue;
 		}
+
+		impact = entry < impact ? entry : impact;
 	}
 
-	size_t interSize = intersections.size();
+	if (impact < 1.0f)
+	{
+		stats.bulletImpacts++;
+	}
+
+	return impact;
+}
+
+//get the potential entities that could be colliding with the given collider
+std::vector<BaseEntity*> SpatialPartition::getNeighbours(Collider * collider)
+{
+	collider->generateHull();
 
 	std::vector<BaseEntity*> neighbours;
 
-	//remove the collider to the 2D partition array
-	for (size_t i = 0; i < interSize; i++)
-	{
-		std::vector<BaseEntity*>* node = &nodes[intersections[i].i][intersections[i].j];
-		size_t nodeSize = node->size();
-		
-		//add every collider from the node
-		for (size_t j = 0; j < nodeSize; j++)
-		{
-			BaseEntity* neighbour = (*node)[j];
+	gatherNeighbours(collider->hull, collider, neighbours);
 
-			//don't make a shape test collisions against itself
-			if (neighbour != entity)
-			{
-				neighbours.push_back(neighbour);
-			}
-		}
-	}
+	return neighbours;
+}
+
+//get the potential entities that could be colliding with the given entity
+std::vector<BaseEntity*> SpatialPartition::getNeighbours(BaseEntity * entity)
+{
+	entity->collider->generateHull();
+
+	std::vector<BaseEntity*> neighbours;
+
+	gatherNeighbours(entity->collider->hull, entity->collider, neighbours);
 
 	return neighbours;
 }
@@ -470,6 +754,13 @@ std::vector<BaseEntity*> SpatialPartition::getNeighbours(BaseEntity * entity)
 //update all of the colliders
 void SpatialPartition::updateAll(float deltaTime, Application2D* appPtr)
 {
+	//the counters describe a single update
+	COLL_SOLVER->resetStats();
+	stats = BroadphaseStats{};
+
+	//every pair is only tested once per update
+	testedPairs.clear();
+
 	size_t entitiesSize = entities.size();
 
 	//move every entity
@@ -499,17 +790,41 @@ void SpatialPartition::updateAll(float deltaTime, Application2D* appPtr)
 			continue;
 		}
 
-		//don't add the entity back if it was deleted during the update
-		removeCollider(&entity, false, 1);
+		//a sleeping entity stays where it is unless its update gave it a velocity
+		if (entity->sleeping)
+		{
+			if (isResting(entity))
+			{
+				continue;
+			}
+
+			wake(entity);
+		}
+
+		Vector2 motion = entity->velocity * deltaTime;
+
+		//a bullet stops just past the first static entity in its way instead of passing through it,
+		//the narrowphase then finds the contact and the solver bounces it
+		if (entity->bullet)
+		{
+			float impact = sweepStatic(entity, motion);
+
+			if (impact < 1.0f)
+			{
+				float fraction = impact + bulletContactDepth / motion.magnitude();
+
+				motion = motion * (fraction < 1.0f ? fraction : 1.0f);
+			}
+		}
 
-		entity->collider->transform.translation += entity->velocity * deltaTime;
+		entity->collider->transform.translation += motion;
 		entity->collider->transform.rotation += entity->angularVelocity * deltaTime;
 
 		//update the matrices, a change was made
 		entity->collider->transform.updateGlobalTransform();
 		entity->collider->transform.updateChildren();
 		
-		registerCollider(entity, false);
+		moveCollider(entity);
 
 		if (entity->collider->transform.parent == nullptr)
 		{
@@ -518,112 +833,462 @@ void SpatialPartition::updateAll(float deltaTime, Application2D* appPtr)
 	
 	}
 
-	entitiesSize = entities.size();
+	narrowphasePairs.clear();
 
-	//test all neighbours for collisions
-	for (size_t i = 0; i < entitiesSize; i++)
+	//the sweep finds every overlapping pair at once, each pair is already unique
+	if (broadphase == BroadphaseType::SWEEP)
 	{
-		BaseEntity* entity = entities[i].entity;
+		sweep.update();
 
-		//object is either sleeping or not recieving collisions
-		if (!entity->awake || !entity->colliding || entity->invMass == 0)
-		{
-			continue;
-		}
+		size_t pairsSize = sweep.pairs.size();
 
-		std::vector<BaseEntity*> neighbours = getNeighbours(entity);
+		stats.candidatePairs = pairsSize;
+		stats.uniquePairs = pairsSize;
 
-		size_t neighSize = neighbours.size();
-
-		for (size_t j = 0; j < neighSize; j++)
+		for (size_t i = 0; i < pairsSize; i++)
 		{
-			
-			BaseEntity* neighbour = neighbours[j];
+			BaseEntity* entity = sweep.pairs[i].A;
+			BaseEntity* neighbour = sweep.pairs[i].B;
 
-			if (entity->type == EntityType::CAR && neighbour->type == EntityType::BASE)
+			//the pair is resolved from the side of an entity that is awake, colliding, can move and isn't sleeping
+			if (!entity->awake || !entity->colliding || entity->invMass == 0 || entity->sleeping)
 			{
-				int a = 0;
+				BaseEntity* temp = entity;
+				entity = neighbour;
+				neighbour = temp;
 			}
 
-			//the two objects don't belong to at least one common layer
-			if ((entity->collider->layer & neighbour->collider->layer) == 0)
+			//two sleeping entities don't need testing
+			if (!entity->awake || !entity->colliding || entity->invMass == 0 || entity->sleeping)
 			{
 				continue;
 			}
 
-			//other object is either sleeping or not recieving collisions
-			if (!neighbour->awake || !neighbour->colliding)
-			{
-				continue;
-			}
+			queuePair(entity, neighbour);
+		}
+	}
+	else
+	{
+		entitiesSize = entities.size();
 
-			float massSum = entity->mass + neighbour->mass;
+		//find the neighbours of every entity
+		for (size_t i = 0; i < entitiesSize; i++)
+		{
+			BaseEntity* entity = entities[i].entity;
 
-			//static objects can't intersect
-			if (massSum == 0)
+			//object is either sleeping or not recieving collisions, sleeping entities are only found by the entities around them
+			if (!entity->awake || !entity->colliding || entity->invMass == 0 || entity->sleeping)
 			{
 				continue;
 			}
 
-			AdvancedCollision advColl = COLL_SOLVER->doBaseEntityIntersectionTest(entity, neighbour, deltaTime);
+			std::vector<BaseEntity*> neighbours = getNeighbours(entity);
+
+			size_t neighSize = neighbours.size();
 
-			if (advColl.intersection)
+			for (size_t j = 0; j < neighSize; j++)
 			{
-				
-				//collision callback
-				entity->collisionCallBack(neighbour);
-				neighbour->collisionCallBack(entity);
+				BaseEntity* neighbour = neighbours[j];
 
-				//are either of the two entities not reacting to collisions
-				if (!entity->reactive || !neighbour->reactive)
+				stats.candidatePairs++;
+
+				//the neighbour was found through more than one node, or it already tested this pair on its own turn
+				if (!testedPairs.insert(EntityPair{ entity, neighbour }).second)
 				{
 					continue;
 				}
 
-				float invMassSum = entity->invMass + neighbour->invMass;
+				stats.uniquePairs++;
 
-				//solve the penetration using the MTV returned from the seperating axis theorem
-				//apply the MTV using a ratio of the masses so that heavier objects move less when hit by larger ones
-				float aRatio = entity->invMass / invMassSum;
-				float bRatio = neighbour->invMass / invMassSum;
+				queuePair(entity, neighbour);
+			}
+		}
+	}
 
-				if (entity->invMass > 0)
-				{
-					removeCollider(&entity, false, 2);
-					entity->collider->transform.translation += advColl.MTV * -aRatio;
+	detectCollisions(deltaTime);
 
-					//update the matrices, a change was made
-					entity->collider->transform.updateGlobalTransform();
-					entity->collider->transform.updateChildren();
+	size_t pairsSize = narrowphasePairs.size();
 
-					registerCollider(entity, false);
-				}
+	//resolve in the order the pairs were found, so the result doesn't depend on how the threads ran
+	for (size_t i = 0; i < pairsSize; i++)
+	{
+		if (narrowphasePairs[i].intersection)
+		{
+			resolveCollision(narrowphasePairs[i]);
+		}
+	}
 
-				if (neighbour->invMass > 0)
-				{
-					removeCollider(&neighbour, false, 3);
-					neighbour->collider->transform.translation += advColl.MTV * bRatio;
+	PHYS_SOLVER->solve(deltaTime);
 
-					//update the matrices, a change was made
-					neighbour->collider->transform.updateGlobalTransform();
-					neighbour->collider->transform.updateChildren();
+	//the solver pushed the bodies apart, update their nodes
+	for (size_t i = 0; i < pairsSize; i++)
+	{
+		const AdvancedCollision& pair = narrowphasePairs[i];
 
-					registerCollider(neighbour, false);
-				}
+		if (!pair.intersection)
+		{
+			continue;
+		}
+
+		if (pair.A->invMass > 0)
+		{
+			moveCollider(pair.A);
+		}
+
+		if (pair.B->invMass > 0)
+		{
+			moveCollider(pair.B);
+		}
+	}
 
-				//calculate the contacts
-				advColl = COLL_SOLVER->calculateContacts(advColl);
+	updateIslands(deltaTime);
+}
 
-				//apply physics impulses to make the collision behave under the laws of physics
-				PHYS_SOLVER->applyImpulse(advColl);
+//add a pair to the narrowphase if the two entities can collide
+void SpatialPartition::queuePair(BaseEntity* entity, BaseEntity* neighbour)
+{
+	//the two objects don't belong to at least one common layer
+	if ((entity->collider->layer & neighbour->collider->layer) == 0)
+	{
+		return;
+	}
+
+	//other object is either sleeping or not recieving collisions
+	if (!neighbour->awake || !neighbour->colliding)
+	{
+		return;
+	}
+
+	float massSum = entity->mass + neighbour->mass;
+
+	//static objects can't intersect
+	if (massSum == 0)
+	{
+		return;
+	}
+
+	AdvancedCollision pair;
+	pair.A = entity;
+	pair.B = neighbour;
+
+	narrowphasePairs.push_back(pair);
+}
+
+//test every queued pair, split between the narrowphase threads
+void SpatialPartition::detectCollisions(float deltaTime)
+{
+	size_t pairsSize = narrowphasePairs.size();
+
+	//build the cached geometry of every collider first, after this the tests only read it
+	for (size_t i = 0; i < pairsSize; i++)
+	{
+		narrowphasePairs[i].A->collider->updateWorldGeometry();
+		narrowphasePairs[i].B->collider->updateWorldGeometry();
+	}
+
+	//every thread counts its tests separately
+	workerStats.assign(narrowphaseThreads.getThreadCount(), NarrowphaseStats{});
+
+	//each pair is only written by the thread that tests it
+	narrowphaseThreads.parallelFor(pairsSize, PARTITION_PAIRS_PER_THREAD, [this, deltaTime](size_t start, size_t end, unsigned int worker)
+	{
+		COLL_SOLVER->redirectStats(&workerStats[worker]);
+
+		for (size_t i = start; i < end; i++)
+		{
+			AdvancedCollision& pair = narrowphasePairs[i];
+			pair = COLL_SOLVER->doBaseEntityIntersectionTest(pair.A, pair.B, deltaTime);
+		}
+
+		COLL_SOLVER->redirectStats(nullptr);
+	});
+
+	size_t workerSize = workerStats.size();
+
+	for (size_t i = 0; i < workerSize; i++)
+	{
+		COLL_SOLVER->stats.tests += workerStats[i].tests;
+		COLL_SOLVER->stats.satTests += workerStats[i].satTests;
+		COLL_SOLVER->stats.allocations += workerStats[i].allocations;
+	}
+}
+
+//push a colliding pair apart and apply the impulses
+void SpatialPartition::resolveCollision(AdvancedCollision& collision)
+{
+	BaseEntity* entity = collision.A;
+	BaseEntity* neighbour = collision.B;
+
+	//collision callback
+	entity->collisionCallBack(neighbour);
+	neighbour->collisionCallBack(entity);
+
+	//are either of the two entities not reacting to collisions
+	if (!entity->reactive || !neighbour->reactive)
+	{
+		return;
+	}
+
+	//a sleeping entity that gets hit has to move again
+	if (neighbour->sleeping)
+	{
+		wake(neighbour);
+	}
+
+	//calculate the contacts
+	collision = COLL_SOLVER->calculateContacts(collision);
+
+	//the contact is solved together with every other contact once they are all found
+	PHYS_SOLVER->addContact(collision);
+}
+
+//compare the velocities to the sleep thresholds, squared to avoid the square root
+bool SpatialPartition::isResting(BaseEntity* entity)
+{
+	return entity->velocity.sqrMagnitude() <= sleepVelocity * sleepVelocity && abs(entity->angularVelocity) <= sleepAngularVelocity;
+}
+
+//wake one entity now and remember its island for the end of the update
+void SpatialPartition::wake(BaseEntity* entity)
+{
+	size_t wokenSize = wokenIslands.size();
+	bool found = false;
+
+	for (size_t i = 0; i < wokenSize; i++)
+	{
+		found = found || wokenIslands[i] == entity->sleepIsland;
+	}
+
+	if (!found)
+	{
+		wokenIslands.push_back(entity->sleepIsland);
+	}
+
+	entity->sleeping = false;
+	entity->restTime = 0.0f;
+	entity->sleepIsland = -1;
+}
+
+//follow the parents up to the root, pointing each entity on the way at its grandparent
+int SpatialPartition::findIsland(int index)
+{
+	while (islandParents[index] != index)
+	{
+		islandParents[index] = islandParents[islandParents[index]];
+		index = islandParents[index];
+	}
+
+	return index;
+}
+
+//wake touched islands, build this update's islands and put the resting ones to sleep
+void SpatialPartition::updateIslands(float deltaTime)
+{
+	sleepStats = SleepStats{};
+
+	size_t entitiesSize = entities.size();
+	size_t wokenSize = wokenIslands.size();
+
+	//the rest of every island that got touched wakes up too
+	if (wokenSize > 0)
+	{
+		for (size_t i = 0; i < entitiesSize; i++)
+		{
+			BaseEntity* entity = entities[i].entity;
+
+			if (!entity->sleeping)
+			{
+				continue;
+			}
+
+			for (size_t j = 0; j < wokenSize; j++)
+			{
+				if (entity->sleepIsland == wokenIslands[j])
+				{
+					entity->sleeping = false;
+					entity->restTime = 0.0f;
+					entity->sleepIsland = -1;
+					break;
+				}
 			}
 		}
 	}
+
+	sleepStats.islandsWoken = wokenSize;
+	wokenIslands.clear();
+
+	//every simulated entity starts in an island of its own
+	islandParents.resize(entitiesSize);
+
+	for (size_t i = 0; i < entitiesSize; i++)
+	{
+		BaseEntity* entity = entities[i].entity;
+
+		entity->islandIndex = (int)i;
+		islandParents[i] = (int)i;
+
+		//static objects and disabled objects aren't simulated
+		if (entity->invMass == 0 || !entity->awake)
+		{
+			continue;
+		}
+
+		//sleeping was turned off since the entity fell asleep
+		if (entity->sleeping && !sleepEnabled)
+		{
+			entity->sleeping = false;
+			entity->sleepIsland = -1;
+		}
+
+		if (entity->sleeping)
+		{
+			sleepStats.sleepingBodies++;
+			continue;
+		}
+
+		entity->restTime = isResting(entity) ? entity->restTime + deltaTime : 0.0f;
+
+		sleepStats.awakeBodies++;
+	}
+
+	if (!sleepEnabled)
+	{
+		return;
+	}
+
+	size_t pairsSize = narrowphasePairs.size();
+
+	//join the moving entities that touched, static objects would join everything so they are left out.
+	//entities registered without full aren't in entities and have no island, they are treated as static too
+	for (size_t i = 0; i < pairsSize; i++)
+	{
+		const AdvancedCollision& pair = narrowphasePairs[i];
+
+		if (!pair.intersection || pair.A->invMass == 0 || pair.B->invMass == 0 || pair.A->staticLayer || pair.B->staticLayer ||
+			pair.A->islandIndex < 0 || pair.B->islandIndex < 0)
+		{
+			continue;
+		}
+
+		int rootA = findIsland(pair.A->islandIndex);
+		int rootB = findIsland(pair.B->islandIndex);
+
+		if (rootA != rootB)
+		{
+			islandParents[rootB] = rootA;
+		}
+	}
+
+	//an island can only sleep once its least rested entity can
+	islandRest.assign(entitiesSize, std::numeric_limits<float>().max());
+	islandIds.assign(entitiesSize, -1);
+
+	for (size_t i = 0; i < entitiesSize; i++)
+	{
+		BaseEntity* entity = entities[i].entity;
+
+		if (entity->invMass == 0 || !entity->awake || entity->sleeping)
+		{
+			continue;
+		}
+
+		int island = findIsland((int)i);
+
+		if (island == (int)i)
+		{
+			sleepStats.islands++;
+		}
+
+		if (entity->restTime < islandRest[island])
+		{
+			islandRest[island] = entity->restTime;
+		}
+	}
+
+	for (size_t i = 0; i < entitiesSize; i++)
+	{
+		BaseEntity* entity = entities[i].entity;
+
+		if (entity->invMass == 0 || !entity->awake || entity->sleeping)
+		{
+			continue;
+		}
+
+		int island = findIsland((int)i);
+
+		if (islandRest[island] < sleepTime)
+		{
+			continue;
+		}
+
+		//the first entity of the island to sleep gives it an id
+		if (islandIds[island] == -1)
+		{
+			islandIds[island] = nextIslandId++;
+			sleepStats.islandsSlept++;
+		}
+
+		entity->sleeping = true;
+		entity->sleepIsland = islandIds[island];
+		entity->velocity = Vector2{};
+		entity->angularVelocity = 0.0f;
+
+		sleepStats.awakeBodies--;
+		sleepStats.sleepingBodies++;
+	}
+}
+
+//runs fixed steps to cover the time passed
+void SpatialPartition::advance(float deltaTime, Application2D* appPtr)
+{
+	timeAccumulator += deltaTime;
+
+	int substeps = 0;
+
+	while (timeAccumulator >= fixedTimeStep && substeps < maxSubsteps)
+	{
+		stepCount++;
+
+		size_t entitiesSize = entities.size();
+
+		//remember where everything was before the step, entities created during it have no previous transform
+		for (size_t i = 0; i < entitiesSize; i++)
+		{
+			entities[i].entity->collider->transform.storePrevious(stepCount);
+		}
+
+		updateAll(fixedTimeStep, appPtr);
+
+		timeAccumulator -= fixedTimeStep;
+		substeps++;
+	}
+
+	//the frame took longer than maxSubsteps can simulate, the game slows down instead
+	if (timeAccumulator >= fixedTimeStep)
+	{
+		timeAccumulator = fmod(timeAccumulator, fixedTimeStep);
+	}
+
+	interpolation = timeAccumulator / fixedTimeStep;
+}
+
+//blends a transform between the last two fixed steps
+Affine2 SpatialPartition::renderTransform(Transform& transform)
+{
+	return transform.getRenderTransform(stepCount, interpolation);
 }
 
 //render every entity contained by the partition
 void SpatialPartition::renderAll(Application2D* appPtr)
 {
+	size_t staticSize = staticEntities.size();
+
+	//render the static layer first, it is underneath everything else
+	for (size_t i = 0; i < staticSize; i++)
+	{
+		staticEntities[i]->render(appPtr);
+	}
+
 	size_t entitiesSize = entities.size();
 
 	//render every entity
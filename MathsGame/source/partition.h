@@ -1,7 +1,17 @@
 #pragma once
 #include <vector>
+#include <unordered_set>
 #include "base_entity.h"
 #include "collision.h"
+#include "aabb_tree.h"
+#include "sweep_and_prune.h"
+#include "thread_pool.h"
+
+//how many entities a node holds in its own slots, any more go into the overflow list
+#define PARTITION_NODE_CAPACITY 8
+
+//fewest narrowphase pairs worth giving to a thread of their own
+#define PARTITION_PAIRS_PER_THREAD 64
 
 /*
 * struct SpatialPartitionEntityPair
@@ -18,17 +28,59 @@ struct SpatialPartitionBodyPair
 	BaseEntity* entity;
 };
 
+//which structure the partition stores its moving colliders in
+enum class BroadphaseType
+{
+	GRID, //the grid, with the tree only holding colliders too big for it or outside of it
+	TREE, //the tree holds every collider, the grid isn't used
+	SWEEP, //stored the same as GRID, but the collision pairs come from a sort and sweep of every collider
+};
+
 /*
-* struct index2D
+* struct SpatialPartitionOverflow
 *
-* index pair for a 2D array, i indexes the first dimension, j indexes the second dimension
+* an entity that didn't fit in its node's slots, and the node it belongs to.
+* the entries of each node are chained together so a node's overflow can be
+* walked without looking at every other node's
 *
 * author: Bradley Booth, Academy of Interactive Entertainment, 2017
 */
-struct index2D
+struct SpatialPartitionOverflow
 {
-	int i;
-	int j;
+	int node;
+	BaseEntity* entity;
+	int next; //the node's next entry (or the next unused entry), -1 at the end of the chain
+};
+
+/*
+* struct BroadphaseStats
+*
+* counters for the pairs found by the last updateAll
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct BroadphaseStats
+{
+	size_t candidatePairs = 0; //every entity-neighbour pair found, including repeats
+	size_t uniquePairs = 0; //pairs left after removing the repeats, these are the ones that reach the narrowphase
+	size_t bulletSweeps = 0; //bullet movements swept against the static layer
+	size_t bulletImpacts = 0; //sweeps that hit the static layer and cut the bullet's movement short
+};
+
+/*
+* struct SleepStats
+*
+* counters for the sleeping done by the last updateAll
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct SleepStats
+{
+	size_t awakeBodies = 0; //moving entities that are being simulated
+	size_t sleepingBodies = 0; //moving entities that are asleep
+	size_t islands = 0; //groups of touching moving entities found this update
+	size_t islandsSlept = 0; //islands put to sleep this update
+	size_t islandsWoken = 0; //sleeping islands woken this update
 };
 
 /*
@@ -66,12 +118,61 @@ public:
 	BaseEntity* root; //special object which is the parent of all other objects in the partition
 
 	Vector2 origin; //the bottom-left corner of the partition
-	float nodeSize = 0; //size of an individual node, all colliders must not suceed 3 times this accross any axis
+	float nodeSize = 0; //size of an individual node, colliders bigger than 6 times this accross any axis are kept in the tree
 	int iLength = 0; //length of the 2D array (1st dimension)
 	int jLength = 0; //length of the 2D array (2nd dimension)
 
 	std::vector<SpatialPartitionBodyPair> entities; //array of entities to go through
-	std::vector<std::vector<std::vector<BaseEntity*>>> nodes; //partition data, a 2D array of arrays of entites
+
+	//partition data, every node has PARTITION_NODE_CAPACITY slots side by side in one array.
+	//node (i, j) is at index i * jLength + j, its slots start at that index * PARTITION_NODE_CAPACITY
+	//-----------------------------------------------------------
+	std::vector<BaseEntity*> nodeSlots; //the entities in each node
+	std::vector<int> nodeCounts; //how many entities are in each node, including the ones in the overflow
+	std::vector<SpatialPartitionOverflow> nodeOverflow; //entities that didn't fit in their node's slots
+	std::vector<int> overflowHeads; //the first entry in nodeOverflow of each node, -1 when the node hasn't overflowed
+	int overflowFree = -1; //the first unused entry in nodeOverflow, -1 when every entry is used
+	//-----------------------------------------------------------
+
+	//static layer, built once by buildStaticLayer and never updated.
+	//the entities in node n are staticNodes[staticOffsets[n]] up to staticNodes[staticOffsets[n + 1]]
+	//-----------------------------------------------------------
+	std::vector<BaseEntity*> staticEntities; //every entity in the static layer, they don't get update calls
+	std::vector<int> staticOffsets; //where each node starts in staticNodes, has one extra entry for the end of the last node
+	std::vector<BaseEntity*> staticNodes; //the entities in each node, back to back
+	//-----------------------------------------------------------
+
+	BroadphaseType broadphase = BroadphaseType::GRID; //where colliders are stored, must be set before any are registered
+	AABBTree tree; //colliders the grid can't hold, or every collider when broadphase is TREE
+	SweepAndPrune sweep; //every collider, including the static layer, only used when broadphase is SWEEP
+
+	std::unordered_set<EntityPair, EntityPairHash> testedPairs; //pairs already tested this update, kept between updates so its memory is reused
+	BroadphaseStats stats; //pair counters for the last updateAll
+
+	ThreadPool narrowphaseThreads; //threads the narrowphase tests are split between, one per hardware thread unless setThreadCount is called
+	std::vector<AdvancedCollision> narrowphasePairs; //every pair tested in the last updateAll with its result, kept so its memory is reused
+
+	//sleeping, moving entities that touch form an island. once every entity in an island
+	//has moved slower than the thresholds for sleepTime seconds, the whole island sleeps
+	//-----------------------------------------------------------
+	bool sleepEnabled = true; //false keeps every entity awake
+	float sleepVelocity = 5.0f; //fastest an entity can move and still be resting
+	float sleepAngularVelocity = 0.1f; //fastest an entity can rotate (radians a second) and still be resting
+	float sleepTime = 0.5f; //seconds every entity in an island has to rest before it sleeps
+	SleepStats sleepStats; //sleep counters for the last updateAll
+	//-----------------------------------------------------------
+
+	//fixed timestep, advance runs updateAll in steps of fixedTimeStep and
+	//renderTransform blends between the last two steps
+	//-----------------------------------------------------------
+	float fixedTimeStep = 1.0f / 60.0f; //seconds simulated by each updateAll
+	int maxSubsteps = 5; //most steps one advance can run, time beyond that is dropped so a slow frame can't snowball
+	float timeAccumulator = 0.0f; //time passed that hasn't been simulated yet
+	unsigned int stepCount = 0; //fixed steps run so far
+	float interpolation = 0.0f; //how far the display is between the last step and the next one, 0 to 1
+	//-----------------------------------------------------------
+
+	float bulletContactDepth = 0.25f; //how far a bullet is moved past the time of impact, so the narrowphase finds the contact
 
 	/*
 	* SpatialPartition()
@@ -97,8 +198,8 @@ public:
 	/*
 	* registerCollider
 	* 
-	* attempts to add an entity to the partition
-	* the collider must take up less space than a square with a side length equal to 3 times the nodeSize
+	* adds an entity to the partition
+	* colliders wider or taller than 6 times the nodeSize, or completely outside of the grid, are added to the tree instead
 	*
 	* @param BaseEntity* entity - the collider to register
 	* @param bool full - whether or not to add the collider to the main array of partitioned objects (entities)
@@ -106,10 +207,23 @@ public:
 	*/
 	bool registerCollider(BaseEntity* entity, bool full);
 
+	/*
+	* buildStaticLayer
+	*
+	* puts entities that will never move into their own layer of the partition.
+	* the layer is packed once and never updated, static entities are found
+	* by getNeighbours but never get update calls or have their nodes changed.
+	* calling it again adds more entities and repacks the whole layer
+	*
+	* @param std::vector<BaseEntity*>& statics - the entities that never move, the partition takes ownership of them
+	* @returns void
+	*/
+	void buildStaticLayer(std::vector<BaseEntity*>& statics);
+
 	/*
 	* removeCollider
 	*
-	* removes all instances of the entity from the partition
+	* removes all instances of the entity from the partition, static entities are blanked out of the static layer
 	* a pointer to the pointer must be used to prevent copying of the actual pointer.
 	* this is necessary since the pointer is assigned to nullptr after a delete
 	*
@@ -120,6 +234,18 @@ public:
 	*/
 	void removeCollider(BaseEntity** entitydPtr, bool full, int id);
 
+	/*
+	* moveCollider
+	*
+	* updates the nodes an entity is in after it has moved, the entity
+	* is only removed from the nodes it left and added to the nodes it entered.
+	* if it is still in the same nodes nothing happens
+	*
+	* @param BaseEntity* entity - the registered entity that moved
+	* @returns void
+	*/
+	void moveCollider(BaseEntity* entity);
+
 	/*
 	* testCollider
 	*
@@ -162,6 +288,30 @@ public:
 	*/
 	void updateAll(float deltaTime, Application2D* appPtr);
 
+	/*
+	* advance
+	*
+	* adds the frame's time to the accumulator and runs as many fixed steps
+	* of updateAll as it covers, up to maxSubsteps. the transforms are stored
+	* before each step so renderTransform can blend between the last two
+	*
+	* @param float deltaTime - amount of time passed since the last frame
+	* @param Application2D* appPtr - pointer to the application2D the entities use
+	* @returns void
+	*/
+	void advance(float deltaTime, Application2D* appPtr);
+
+	/*
+	* renderTransform
+	*
+	* gets the transformation to draw a transform with,
+	* blended between the last two fixed steps by interpolation
+	*
+	* @param Transform& transform - the transform to draw
+	* @returns Affine2 - the blended global transformation
+	*/
+	Affine2 renderTransform(Transform& transform);
+
 	/*
 	* renderAll
 	*
@@ -172,4 +322,175 @@ public:
 	*/
 	void renderAll(Application2D* appPtr);
 
+protected:
+
+	/*
+	* getNodeRange
+	*
+	* gets the first and last node a hull intersects, clamped to the partition
+	*
+	* @param AABB* hull - the hull to find the nodes of
+	* @param index2D& start - set to the first node
+	* @param index2D& end - set to the last node
+	* @returns bool - false if the hull doesn't intersect the partition at all
+	*/
+	bool getNodeRange(AABB* hull, index2D& start, index2D& end);
+
+	/*
+	* fitsGrid
+	*
+	* checks if a collider should be stored in the grid rather than the tree
+	*
+	* @param AABB* hull - the collider's hull
+	* @param index2D& start - set to the first node the hull intersects
+	* @param index2D& end - set to the last node the hull intersects
+	* @returns bool - true if the grid is in use, the hull isn't too big and it reaches into the grid
+	*/
+	bool fitsGrid(AABB* hull, index2D& start, index2D& end);
+
+	/*
+	* addToNode
+	*
+	* adds an entity to a node, it goes in the overflow if the node's slots are full
+	*
+	* @param int node - the index of the node
+	* @param BaseEntity* entity - the entity to add
+	* @returns void
+	*/
+	void addToNode(int node, BaseEntity* entity);
+
+	/*
+	* removeFromNode
+	*
+	* removes an entity from a node, the last entity in the node is moved into its place
+	*
+	* @param int node - the index of the node
+	* @param BaseEntity* entity - the entity to remove
+	* @returns void
+	*/
+	void removeFromNode(int node, BaseEntity* entity);
+
+	/*
+	* releaseOverflow
+	*
+	* unlinks an entry from a node's overflow chain and adds it to the unused entries
+	*
+	* @param int node - the node the entry belongs to
+	* @param int previous - the entry before it in the chain, -1 if it is the first
+	* @param int entry - the entry to release
+	* @returns void
+	*/
+	void releaseOverflow(int node, int previous, int entry);
+
+	/*
+	* gatherNeighbours
+	*
+	* adds every entity in the nodes the hull intersects to a list
+	*
+	* @param AABB* hull - the area to search
+	* @param Collider* excluded - the collider doing the search, it is left out of the list
+	* @param std::vector<BaseEntity*>& neighbours - the list to add to
+	* @returns void
+	*/
+	void gatherNeighbours(AABB* hull, Collider* excluded, std::vector<BaseEntity*>& neighbours);
+
+	std::vector<BaseEntity*> bulletNeighbours; //static entities near a bullet's path, kept between sweeps so its memory is reused
+
+	/*
+	* sweepStatic
+	*
+	* sweeps an entity's hull along its movement against the hulls of the static layer.
+	* hulls that already overlap at the start are left to the narrowphase.
+	* the hulls are exact for boxes and a little early for other shapes,
+	* a bullet stopped early moves the rest of the way in the next step
+	*
+	* @param BaseEntity* entity - the bullet
+	* @param Vector2 motion - how far the bullet is moving this step
+	* @returns float - the time of impact as a fraction of the motion, 1 if nothing is hit
+	*/
+	float sweepStatic(BaseEntity* entity, Vector2 motion);
+
+	std::vector<int> islandParents; //the union-find parent of each entity while islands are built
+	std::vector<float> islandRest; //the shortest rest time in each island, indexed by the island's root
+	std::vector<int> islandIds; //the sleep id given to each island put to sleep, indexed by the island's root
+	std::vector<int> wokenIslands; //sleeping islands touched this update, the rest of their entities are woken at the end of it
+	int nextIslandId = 0; //the id the next island put to sleep gets
+
+	std::vector<NarrowphaseStats> workerStats; //the narrowphase counters of each thread, added to the solver's after the tests
+
+	/*
+	* queuePair
+	*
+	* adds a pair to narrowphasePairs, unless they share no layers, the neighbour
+	* is asleep or not colliding, or neither of them has mass
+	*
+	* @param BaseEntity* entity - the entity that found the pair, it must be awake, colliding and able to move
+	* @param BaseEntity* neighbour - the other entity
+	* @returns void
+	*/
+	void queuePair(BaseEntity* entity, BaseEntity* neighbour);
+
+	/*
+	* detectCollisions
+	*
+	* runs the narrowphase on every pair in narrowphasePairs, split between the narrowphase threads.
+	* nothing is moved, each pair is only given its result
+	*
+	* @param float deltaTime - amount of time passed since the last frame
+	* @returns void
+	*/
+	void detectCollisions(float deltaTime);
+
+	/*
+	* resolveCollision
+	*
+	* runs the callbacks of an intersecting pair and adds its contact to the physics solver
+	*
+	* @param AdvancedCollision& collision - the result of the pair's narrowphase test
+	* @returns void
+	*/
+	void resolveCollision(AdvancedCollision& collision);
+
+	/*
+	* isResting
+	*
+	* checks if an entity is moving slower than the sleep thresholds
+	*
+	* @param BaseEntity* entity - the entity to check
+	* @returns bool - true if both its velocity and angular velocity are under the thresholds
+	*/
+	bool isResting(BaseEntity* entity);
+
+	/*
+	* wake
+	*
+	* wakes an entity straight away, the rest of its island is woken at the end of the update
+	*
+	* @param BaseEntity* entity - the sleeping entity
+	* @returns void
+	*/
+	void wake(BaseEntity* entity);
+
+	/*
+	* findIsland
+	*
+	* finds the root of the island an entity is in, shortening the path to it on the way
+	*
+	* @param int index - the entity's position in entities
+	* @returns int - the position of the island's root
+	*/
+	int findIsland(int index);
+
+	/*
+	* updateIslands
+	*
+	* wakes the islands that were touched, updates every entity's rest time, joins
+	* the entities that touched this update into islands and puts the islands that
+	* have rested long enough to sleep
+	*
+	* @param float deltaTime - amount of time passed since the last frame
+	* @returns void
+	*/
+	void updateIslands(float deltaTime);
+
 };
\ No newline at end of file
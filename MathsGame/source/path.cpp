@@ -1,6 +1,8 @@
 #include "path.h"
 #include "Application2D.h"
 
+#include <algorithm>
+
 //delete all of the nodes
 Path::~Path()
 {
@@ -10,6 +12,13 @@ Path::~Path()
 	{
 		delete nodes[i];
 	}
+
+	size_t poolSize = searchPool.size();
+
+	for (size_t i = 0; i < poolSize; i++)
+	{
+		delete searchPool[i];
+	}
 }
 
 //creates nodes and connections by examining a container
@@ -40,15 +49,15 @@ void Path::generateNodesRecursive(Container* container, bool subLevel, Node* pre
 		Connection rightPrev = Connection{};
 		Connection prevRight = Connection{};
 
-		//calulate cost of connections from squaredDistance
-		float leftCost = (leftNode->position - prevNode->position).sqrMagnitude();
+		//calulate cost of connections from distance, so the straight line distance is a close heuristic
+		float leftCost = (leftNode->position - prevNode->position).magnitude();
 		leftPrev.destination = prevNode;
 		prevLeft.destination = leftNode;
 
 		leftPrev.cost = leftCost;
 		prevLeft.cost = leftCost;
 
-		float rightCost = (rightNode->position - prevNode->position).sqrMagnitude();
+		float rightCost = (rightNode->position - prevNode->position).magnitude();
 		rightPrev.destination = prevNode;
 		prevRight.destination = rightNode;
 
@@ -60,13 +69,20 @@ void Path::generateNodesRecursive(Container* container, bool subLevel, Node* pre
 
 		leftNode->conns.push_back(leftPrev);
 		rightNode->conns.push_back(rightPrev);
+
+		//the new nodes hang below the previous node in the tree
+		leftNode->parent = prevNode;
+		leftNode->depth = prevNode->depth + 1;
+
+		rightNode->parent = prevNode;
+		rightNode->depth = prevNode->depth + 1;
 	}
 	else //only connections between the left and right nodes need to be made
 	{
 		Connection leftRight = Connection{};
 		Connection rightLeft = Connection{};
 
-		float cost = (rightNode->position - leftNode->position).sqrMagnitude();
+		float cost = (rightNode->position - leftNode->position).magnitude();
 		leftRight.destination = rightNode;
 		rightLeft.destination = leftNode;
 
@@ -75,16 +91,32 @@ void Path::generateNodesRecursive(Container* container, bool subLevel, Node* pre
 
 		leftNode->conns.push_back(leftRight);
 		rightNode->conns.push_back(rightLeft);
+
+		//the left node is the root, the only other node it's connected to is the right node
+		leftNode->parent = nullptr;
+		leftNode->depth = 0;
+
+		rightNode->parent = leftNode;
+		rightNode->depth = 1;
 	}
 
 
+	leftNode->id = (int)nodes.size();
 	nodes.push_back(leftNode);
+
+	rightNode->id = (int)nodes.size();
 	nodes.push_back(rightNode);
 
 	//call the function recursively on each sub-container
 	generateNodesRecursive(container->leftChild, true, leftNode);
 	generateNodesRecursive(container->rightChild, true, rightNode);
-	
+
+	//the whole graph exists once the first call finishes
+	if (!subLevel)
+	{
+		updateHeuristicScale();
+		treeShaped = true;
+	}
 }
 
 //add an offset to all nodes
@@ -122,114 +154,390 @@ void Path::scale(float scalar)
 	}
 }
 
-//sets all the nodes as not transversed
-void Path::resetNodes()
+//finds the lowest cost per unit of distance of any connection
+void Path::updateHeuristicScale()
 {
+	float lowest = std::numeric_limits<float>::max();
+
 	size_t nodeSize = nodes.size();
 
-	//iterate through all the nodes
+	//iterate through all of the nodes
 	for (size_t i = 0; i < nodeSize; i++)
 	{
-		nodes[i]->transversed = false;
+		size_t connSize = nodes[i]->conns.size();
+
+		//iterate through all of the connections
+		for (size_t j = 0; j < connSize; j++)
+		{
+			float distance = (nodes[i]->conns[j].destination->position - nodes[i]->position).magnitude();
+
+			if (distance > 0.0f && nodes[i]->conns[j].cost / distance < lowest)
+			{
+				lowest = nodes[i]->conns[j].cost / distance;
+			}
+		}
 	}
+
+	//nothing to measure, without a heuristic the search is dijkstra's
+	heuristicScale = lowest == std::numeric_limits<float>::max() ? 0.0f : lowest;
 }
 
-//find the shortest path between two nodes
+//places a node in the open heap at a position, then moves it up until the node above it has a lower estimate
+static void siftUp(PathSearch& search, int position, PathSearch::OpenNode node)
+{
+	while (position > 0)
+	{
+		int parent = (position - 1) / 2;
+
+		if (search.open[parent].estimate <= node.estimate)
+		{
+			break;
+		}
+
+		//move the parent down into the gap
+		search.open[position] = search.open[parent];
+		search.heapPositions[search.open[position].id] = position;
+
+		position = parent;
+	}
+
+	search.open[position] = node;
+	search.heapPositions[node.id] = position;
+}
+
+//places a node in the open heap at a position, then moves it down until both nodes below it have higher estimates
+static void siftDown(PathSearch& search, int position, PathSearch::OpenNode node)
+{
+	int openSize = (int)search.open.size();
+
+	while (true)
+	{
+		int child = position * 2 + 1;
+
+		if (child >= openSize)
+		{
+			break;
+		}
+
+		//pick the lower of the two children
+		if (child + 1 < openSize && search.open[child + 1].estimate < search.open[child].estimate)
+		{
+			child++;
+		}
+
+		if (search.open[child].estimate >= node.estimate)
+		{
+			break;
+		}
+
+		//move the child up into the gap
+		search.open[position] = search.open[child];
+		search.heapPositions[search.open[position].id] = position;
+
+		position = child;
+	}
+
+	search.open[position] = node;
+	search.heapPositions[node.id] = position;
+}
+
+//removes the node with the lowest estimate from the open heap and closes it
+static int popOpen(PathSearch& search)
+{
+	int id = search.open[0].id;
+	search.heapPositions[id] = PATH_CLOSED;
+
+	PathSearch::OpenNode last = search.open.back();
+	search.open.pop_back();
+
+	//fill the gap at the top with the last node
+	if (search.open.size() > 0)
+	{
+		siftDown(search, 0, last);
+	}
+
+	return id;
+}
+
+//take a search out of the pool
+PathSearch* Path::acquireSearch()
+{
+	std::lock_guard<std::mutex> lock(searchPoolMutex);
+
+	if (searchPool.size() == 0)
+	{
+		return new PathSearch{};
+	}
+
+	PathSearch* search = searchPool.back();
+	searchPool.pop_back();
+
+	return search;
+}
+
+//put a search back in the pool
+void Path::releaseSearch(PathSearch* search)
+{
+	std::lock_guard<std::mutex> lock(searchPoolMutex);
+
+	searchPool.push_back(search);
+}
+
+//find the shortest path between two nodes with a pooled search
 std::vector<Node*> Path::calculatePath(Node * begin, Node * end)
 {
+	//a tree doesn't need a search
+	if (treeShaped)
+	{
+		return calculateTreePath(begin, end);
+	}
 
-	begin->transversed = true;
+	PathSearch* search = acquireSearch();
 
-	std::vector<Node*> open;
+	std::vector<Node*> path = calculatePath(begin, end, *search);
 
-	//add the starting node to be searched
-	open.push_back(begin);
+	releaseSearch(search);
 
-	bool foundEnd = false;
+	return path;
+}
 
-	//continue searching nodes as long as there is another node that hasn't been discovered yet
-	while (open.size() > 0)
+//adds the neighbours of a node to the open heap, or lowers their estimates if the node gives them a cheaper route
+static void expandNode(PathSearch& search, Node* current, Node* end, float heuristicScale)
+{
+	float currentCost = search.costs[current->id];
+
+	size_t connSize = current->conns.size();
+
+	//iterate through all the connections
+	for (size_t i = 0; i < connSize; i++)
 	{
+		Node* next = current->conns[i].destination;
 
-		size_t connSize = open[0]->conns.size();
-		
-		//iterate through all the connections
-		for (size_t i = 0; i < connSize; i++)
+		search.visit(next->id);
+
+		int position = search.heapPositions[next->id];
+
+		//the shortest route to the node is already known
+		if (position == PATH_CLOSED)
 		{
-			Node* next = open[0]->conns[i].destination;
-			float cost = open[0]->carriedScore + open[0]->conns[i].cost;
+			continue;
+		}
 
-			//if the node hasn't been searched yet or it's given score is higher than the incoming score
-			if (!next->transversed || cost < next->carriedScore)
-			{
-				next->transversed = true;
-				next->carriedScore = cost;
+		float cost = currentCost + current->conns[i].cost;
 
-				open.push_back(next);
-			}
+		//the node has been reached a cheaper way already
+		if (cost >= search.costs[next->id])
+		{
+			continue;
+		}
 
-			//found the end, stop searching for it
-			if (next == end)
-			{
-				foundEnd = true;
-				break;
-			}
+		search.costs[next->id] = cost;
+		search.parents[next->id] = current;
+
+		//without an end to head for there is no heuristic
+		float estimate = end == nullptr ? cost : cost + (end->position - next->position).magnitude() * heuristicScale;
+
+		PathSearch::OpenNode open = PathSearch::OpenNode{ next->id, estimate };
+
+		//add the node to the heap, or move it up now that its estimate is lower
+		if (position == PATH_UNVISITED)
+		{
+			search.open.push_back(open);
+			position = (int)search.open.size() - 1;
 		}
 
-		//break out of this loop if the end is found
-		if (foundEnd)
+		siftUp(search, position, open);
+	}
+}
+
+//find the shortest path between two nodes
+std::vector<Node*> Path::calculatePath(Node * begin, Node * end, PathSearch& search)
+{
+	//a tree doesn't need a search
+	if (treeShaped)
+	{
+		return calculateTreePath(begin, end);
+	}
+
+	search.reset(nodes.size());
+
+	//add the starting node to be searched
+	search.visit(begin->id);
+	search.costs[begin->id] = 0.0f;
+	search.open.push_back(PathSearch::OpenNode{ begin->id, (end->position - begin->position).magnitude() * heuristicScale });
+	search.heapPositions[begin->id] = 0;
+
+	bool foundEnd = false;
+
+	//continue searching nodes as long as there is another node that hasn't been discovered yet
+	while (search.open.size() > 0)
+	{
+		Node* current = nodes[popOpen(search)];
+
+		//the heuristic never overestimates, so once the end is the lowest node its route is the shortest
+		if (current == end)
 		{
+			foundEnd = true;
 			break;
 		}
 
-		open.erase(open.begin());
+		expandNode(search, current, end, heuristicScale);
 	}
 
 	//the end was not found, return an empty list
 	if (!foundEnd)
 	{
-		resetNodes();
 		return std::vector<Node*>{};
 	}
 
 	std::vector<Node*> path;
 
-	Node* back = end;
+	//follow the parents back to the start, it is the only node without one
+	for (Node* back = end; back != nullptr; back = search.parents[back->id])
+	{
+		path.push_back(back);
+	}
+
+	return path;
+}
+
+//find the only path between two nodes of a tree
+std::vector<Node*> Path::calculateTreePath(Node * begin, Node * end)
+{
+	std::vector<Node*> path;
+
+	//the part of the route walked up from the end, it is added to the path in reverse afterwards
+	std::vector<Node*> endSide;
 
-	path.push_back(back);
+	Node* up = begin;
+	Node* down = end;
 
-	//backtrack to the start
-	while (back != begin)
+	//bring the deeper of the two up to the depth of the other
+	while (up->depth > down->depth)
 	{
-		Node* bestNode = nullptr;
-		float smallestScore = std::numeric_limits<float>().max();
+		path.push_back(up);
+		up = up->parent;
+	}
 
-		size_t connSize = back->conns.size();
+	while (down->depth > up->depth)
+	{
+		endSide.push_back(down);
+		down = down->parent;
+	}
 
-		//iterate through all the connections
-		for (size_t i = 0; i < connSize; i++)
+	//walk both up together until they meet at the lowest parent they share
+	while (up != down)
+	{
+		//nodes from different trees, they aren't connected
+		if (up->parent == nullptr || down->parent == nullptr)
 		{
-			Node* next = back->conns[i].destination;
-			float score = next->carriedScore;
-
-			//if the node has been searched and it's score is the lower than the current lowest score
-			if (next->transversed && score < smallestScore)
-			{
-				bestNode = next;
-				smallestScore = score;
-			}
+			return std::vector<Node*>{};
 		}
 
-		back = bestNode;
+		path.push_back(up);
+		up = up->parent;
 
-		//add the node
-		path.push_back(back);
+		endSide.push_back(down);
+		down = down->parent;
 	}
 
-	resetNodes();
+	//the shared parent
+	path.push_back(up);
+
+	//continue back down to the end
+	path.insert(path.end(), endSide.rbegin(), endSide.rend());
+
+	//calculatePath's paths go from the end back to the begin
+	std::reverse(path.begin(), path.end());
+
 	return path;
 }
 
+//find the shortest paths from many nodes to one end with a single search
+void Path::calculatePathsTo(Node * end, const std::vector<Node*>& begins, std::vector<std::vector<Node*>>& paths, PathSearch& search)
+{
+	search.reset(nodes.size());
+
+	size_t beginsSize = begins.size();
+
+	paths.resize(beginsSize);
+
+	size_t remaining = 0;
+
+	//mark every start, a start asked for more than once is only counted once
+	for (size_t i = 0; i < beginsSize; i++)
+	{
+		int id = begins[i]->id;
+
+		search.visit(id);
+
+		if (search.targets[id] != search.generation)
+		{
+			search.targets[id] = search.generation;
+			remaining++;
+		}
+	}
+
+	//search outwards from the end, the parents lead back to it
+	search.visit(end->id);
+	search.costs[end->id] = 0.0f;
+	search.open.push_back(PathSearch::OpenNode{ end->id, 0.0f });
+	search.heapPositions[end->id] = 0;
+
+	//stop once the shortest route of every start is known
+	while (search.open.size() > 0 && remaining > 0)
+	{
+		Node* current = nodes[popOpen(search)];
+
+		if (search.targets[current->id] == search.generation)
+		{
+			remaining--;
+		}
+
+		expandNode(search, current, nullptr, 0.0f);
+	}
+
+	for (size_t i = 0; i < beginsSize; i++)
+	{
+		std::vector<Node*>& path = paths[i];
+		path.clear();
+
+		//the start couldn't be reached, it gets an empty list
+		if (search.heapPositions[begins[i]->id] != PATH_CLOSED)
+		{
+			continue;
+		}
+
+		//follow the parents from the start to the end, then flip it so the end is first like calculatePath
+		for (Node* back = begins[i]; back != nullptr; back = search.parents[back->id])
+		{
+			path.push_back(back);
+		}
+
+		std::reverse(path.begin(), path.end());
+	}
+}
+
+//find the shortest route from every node to one end
+void Path::calculateField(Node * end, PathSearch& search)
+{
+	search.reset(nodes.size());
+
+	//search outwards from the end, the parents lead back to it
+	search.visit(end->id);
+	search.costs[end->id] = 0.0f;
+	search.open.push_back(PathSearch::OpenNode{ end->id, 0.0f });
+	search.heapPositions[end->id] = 0;
+
+	//every node the end can be reached from is searched
+	while (search.open.size() > 0)
+	{
+		Node* current = nodes[popOpen(search)];
+
+		expandNode(search, current, nullptr, 0.0f);
+	}
+}
+
 void Path::render(Application2D * appPtr)
 {
 	size_t nodeSize = nodes.size();
@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <limits>
+#include <mutex>
 #include "container.h"
 #include "maths_library.h"
 
@@ -9,6 +11,12 @@ class Application2D;
 //forward declaration of connection
 struct Connection;
 
+//heap position of a node the search hasn't reached yet
+#define PATH_UNVISITED -1
+
+//heap position of a node the search has finished with
+#define PATH_CLOSED -2
+
 /*
 * class Node
 *
@@ -22,8 +30,10 @@ struct Node
 	Vector2 position; //position of the node
 	std::vector<Connection> conns; //array of outgoing connections
 
-	bool transversed = false;
-	float carriedScore = 0.0f; //used by the pathfinder to represent the cost to move to the node given a starting point
+	int id = -1; //position of the node in Path::nodes, the pathfinder's search state is indexed by it
+
+	Node* parent = nullptr; //the node above this one in the BSP tree, nullptr for the root
+	int depth = 0; //how many parents are above this node
 };
 
 /*
@@ -40,6 +50,94 @@ struct Connection
 	float cost = 0.0f; //distance between the two nodes (NOTE: this doesn't have to be the literal distance)
 };
 
+/*
+* struct PathSearch
+*
+* the state of one calculatePath query, every list is indexed by Node::id.
+* nothing is stored on the nodes, so queries don't share any state.
+* a node's entries are only valid if its stamp matches the generation,
+* so starting a new query is a counter bump instead of clearing the lists
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct PathSearch
+{
+	/*
+	* struct OpenNode
+	*
+	* a node waiting to be searched, the estimate is kept
+	* next to the id so the heap doesn't have to look it up
+	*
+	* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+	*/
+	struct OpenNode
+	{
+		int id; //the node's id
+		float estimate; //cost plus the heuristic's guess of the rest of the way, the heap is ordered by it
+	};
+
+	std::vector<float> costs; //cheapest known cost from the start to each node
+	std::vector<Node*> parents; //the node each node is reached from on its cheapest known route
+	std::vector<int> heapPositions; //each node's position in open, PATH_UNVISITED or PATH_CLOSED if it isn't in it
+	std::vector<unsigned int> stamps; //the generation each node's entries were written in
+	std::vector<unsigned int> targets; //the generation each node was made a start of calculatePathsTo in
+	unsigned int generation = 0; //the current query's stamp, entries with any other stamp are left over from older queries
+	std::vector<OpenNode> open; //binary heap of the nodes to search, lowest estimate first
+
+	/*
+	* reset
+	*
+	* starts a new query, every node becomes unvisited without
+	* touching the lists. they only grow if the graph has grown
+	*
+	* @param size_t nodeCount - how many nodes the graph has
+	* @returns void
+	*/
+	void reset(size_t nodeCount)
+	{
+		generation++;
+
+		//the counter wrapped around, stamps from long ago could match it again
+		if (generation == 0)
+		{
+			stamps.assign(stamps.size(), 0);
+			targets.assign(targets.size(), 0);
+			generation = 1;
+		}
+
+		if (stamps.size() < nodeCount)
+		{
+			costs.resize(nodeCount);
+			parents.resize(nodeCount);
+			heapPositions.resize(nodeCount);
+			stamps.resize(nodeCount, 0);
+			targets.resize(nodeCount, 0);
+		}
+
+		open.clear();
+	}
+
+	/*
+	* visit
+	*
+	* readies a node's entries for the current query, entries
+	* left over from an older query are set back to unvisited
+	*
+	* @param int id - the node's id
+	* @returns void
+	*/
+	void visit(int id)
+	{
+		if (stamps[id] != generation)
+		{
+			stamps[id] = generation;
+			costs[id] = std::numeric_limits<float>::max();
+			parents[id] = nullptr;
+			heapPositions[id] = PATH_UNVISITED;
+		}
+	}
+};
+
 /*
 * class Path
 *
@@ -54,6 +152,12 @@ public:
 
 	std::vector<Node*> nodes; //list of nodes in the list
 
+	float heuristicScale = 0.0f; //lowest cost per unit of distance of any connection, scaling the heuristic by it means it never overestimates
+	bool treeShaped = false; //true if every connection is between a node and its parent, set by generateNodesRecursive. calculatePath walks the tree instead of searching
+
+	std::vector<PathSearch*> searchPool; //searches not being used by a query, reused so that queries don't allocate them
+	std::mutex searchPoolMutex; //guards searchPool, queries can be made from any thread
+
 	/*
 	* Path()
 	* default constructor
@@ -62,7 +166,7 @@ public:
 
 	/*
 	* ~Path()
-	* destructor, deletes all of the nodes
+	* destructor, deletes all of the nodes and pooled searches
 	*/
 	~Path();
 
@@ -101,26 +205,101 @@ public:
 	void scale(float scalar);
 
 	/*
-	* resetNodes
+	* updateHeuristicScale
 	*
-	* sets all the nodes as not transversed
+	* finds the lowest cost per unit of distance over every connection.
+	* connection costs don't have to be distances, this keeps the heuristic admissible anyway
 	*
 	* @returns void
 	*/
-	void resetNodes();
+	void updateHeuristicScale();
 
 	/*
 	* calculatePath
 	*
-	* uses dijkstra's algorithm to find the shortest path
-	* between two nodes, returns nothing if there was no path
-	* https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm
+	* uses A* to find the shortest path between two nodes, returns nothing if there was no path.
+	* the open list is a binary heap indexed by node, the heuristic is the straight line
+	* distance to the end scaled by heuristicScale. uses calculateTreePath instead if treeShaped is set
+	* https://en.wikipedia.org/wiki/A*_search_algorithm
 	*
 	* @param Node* begin - the node to start the search at
 	* @param Node* end - the node to end the search on
-	* @returns std::vector<Node*> - an ordered list of nodes that make up the path
+	* @param PathSearch& search - the state to search with, only one query can use it at a time
+	* @returns std::vector<Node*> - an ordered list of nodes that make up the path, from end back to begin
+	*/
+	std::vector<Node*> calculatePath(Node* begin, Node* end, PathSearch& search);
+
+	/*
+	* calculateTreePath
+	*
+	* finds the path between two nodes of a tree shaped graph without searching. there is only one
+	* route between two nodes of a tree, up from each of them to the lowest parent they share,
+	* so the path is found by walking up the parents. takes as many steps as the path is long
+	*
+	* @param Node* begin - the node to start at
+	* @param Node* end - the node to end on
+	* @returns std::vector<Node*> - an ordered list of nodes that make up the path, from end back to begin
+	*/
+	std::vector<Node*> calculateTreePath(Node* begin, Node* end);
+
+	/*
+	* calculatePath
+	*
+	* finds the shortest path with a search taken from the pool, or calculateTreePath
+	* if treeShaped is set. safe to call from several threads at once
+	*
+	* @param Node* begin - the node to start the search at
+	* @param Node* end - the node to end the search on
+	* @returns std::vector<Node*> - an ordered list of nodes that make up the path, from end back to begin
 	*/
 	std::vector<Node*> calculatePath(Node* begin, Node* end);
 
+	/*
+	* calculatePathsTo
+	*
+	* finds the shortest paths from any number of nodes to the same end with one
+	* dijkstra's search outwards from the end. every connection must have a matching
+	* connection back with the same cost, generateNodesRecursive always makes them that way
+	*
+	* @param Node* end - the node every path ends on
+	* @param const std::vector<Node*>& begins - the nodes the paths start at
+	* @param std::vector<std::vector<Node*>>& paths - filled with a path for each start in the same order as calculatePath, empty if there was no path
+	* @param PathSearch& search - the state to search with, only one query can use it at a time
+	* @returns void
+	*/
+	void calculatePathsTo(Node* end, const std::vector<Node*>& begins, std::vector<std::vector<Node*>>& paths, PathSearch& search);
+
+	/*
+	* calculateField
+	*
+	* finds the shortest route from every node to one end with a dijkstra's search outwards
+	* from the end. afterwards a node's parent in the search is the next node on its route,
+	* the same as calculatePathsTo every connection must have a matching connection back
+	*
+	* @param Node* end - the node every route ends on
+	* @param PathSearch& search - the state to search with, it holds the routes afterwards
+	* @returns void
+	*/
+	void calculateField(Node* end, PathSearch& search);
+
+	/*
+	* acquireSearch
+	*
+	* takes a search out of the pool, a new one is made if the pool is empty
+	*
+	* @returns PathSearch* - a search no other query is using
+	*/
+	PathSearch* acquireSearch();
+
+	/*
+	* releaseSearch
+	*
+	* puts a search back in the pool once its query is finished
+	*
+	* @param PathSearch* search - the search to put back
+	* @returns void
+	*/
+	void releaseSearch(PathSearch* search);
+
 	void render(Application2D* appPtr);
 };
\ No newline at end of file
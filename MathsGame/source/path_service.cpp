@@ -0,0 +1,180 @@
+#include "path_service.h"
+#include <chrono>
+
+//queue a request for the next update
+int PathService::submit(Node * begin, Node * end)
+{
+	PathRequest request;
+	request.ticket = nextTicket++;
+	request.begin = begin;
+	request.end = end;
+
+	pending.push_back(request);
+
+	return request.ticket;
+}
+
+//take a searched path
+bool PathService::collect(int ticket, std::vector<Node*>& result)
+{
+	auto found = finished.find(ticket);
+
+	//not searched yet
+	if (found == finished.end())
+	{
+		return false;
+	}
+
+	result = std::move(found->second);
+	finished.erase(found);
+
+	return true;
+}
+
+//forget a request
+void PathService::cancel(int ticket)
+{
+	finished.erase(ticket);
+
+	size_t pendingSize = pending.size();
+
+	for (size_t i = 0; i < pendingSize; i++)
+	{
+		if (pending[i].ticket == ticket)
+		{
+			pending.erase(pending.begin() + i);
+			break;
+		}
+	}
+}
+
+//search for the waiting requests
+void PathService::update()
+{
+	stats = PathServiceStats{};
+	stats.requests = pending.size();
+
+	if (pending.size() == 0)
+	{
+		return;
+	}
+
+	//group the requests by their end, the groups are in the order of their oldest request
+	//-----------------------------------------------------------
+	groupCount = 0;
+	groupIndices.clear();
+
+	size_t pendingSize = pending.size();
+
+	for (size_t i = 0; i < pendingSize; i++)
+	{
+		PathRequest& request = pending[i];
+
+		auto found = groupIndices.find(request.end);
+
+		size_t index;
+
+		if (found == groupIndices.end())
+		{
+			index = groupCount++;
+			groupIndices[request.end] = index;
+
+			if (groups.size() < groupCount)
+			{
+				groups.push_back(PathRequestGroup{});
+			}
+
+			//empty the group, keeping its memory
+			PathRequestGroup& group = groups[index];
+			group.end = request.end;
+			group.begins.clear();
+			group.tickets.clear();
+			group.done = false;
+		}
+		else
+		{
+			index = found->second;
+		}
+
+		groups[index].begins.push_back(request.begin);
+		groups[index].tickets.push_back(request.ticket);
+	}
+
+	pending.clear();
+	//-----------------------------------------------------------
+
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+		std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(frameBudget));
+
+	//each worker always searches its first group so every update makes progress
+	ThreadPool::Job job = [this, deadline](size_t start, size_t end, unsigned int)
+	{
+		PathSearch* search = path->acquireSearch();
+
+		for (size_t i = start; i < end; i++)
+		{
+			if (i != start && std::chrono::steady_clock::now() >= deadline)
+			{
+				break;
+			}
+
+			PathRequestGroup& group = groups[i];
+
+			//a tree has only one route between two nodes, walking up the parents is cheaper than searching
+			if (path->treeShaped)
+			{
+				size_t beginsSize = group.begins.size();
+
+				group.paths.resize(beginsSize);
+
+				for (size_t j = 0; j < beginsSize; j++)
+				{
+					group.paths[j] = path->calculateTreePath(group.begins[j], group.end);
+				}
+			}
+			else
+			{
+				path->calculatePathsTo(group.end, group.begins, group.paths, *search);
+			}
+
+			group.done = true;
+		}
+
+		path->releaseSearch(search);
+	};
+
+	if (workers != nullptr)
+	{
+		workers->parallelFor(groupCount, 1, job);
+	}
+	else
+	{
+		job(0, groupCount, 0);
+	}
+
+	//hand out the paths, the groups the budget didn't reach go back in the queue
+	for (size_t i = 0; i < groupCount; i++)
+	{
+		PathRequestGroup& group = groups[i];
+
+		size_t requestsSize = group.tickets.size();
+
+		if (!group.done)
+		{
+			for (size_t j = 0; j < requestsSize; j++)
+			{
+				pending.push_back(PathRequest{ group.tickets[j], group.begins[j], group.end });
+			}
+
+			stats.deferred += requestsSize;
+			continue;
+		}
+
+		stats.searches++;
+
+		for (size_t j = 0; j < requestsSize; j++)
+		{
+			finished[group.tickets[j]] = std::move(group.paths[j]);
+		}
+	}
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <vector>
+#include <unordered_map>
+#include "path.h"
+#include "thread_pool.h"
+
+//ticket held by something that isn't waiting on a path
+#define PATH_TICKET_NONE -1
+
+/*
+* struct PathRequest
+*
+* a path asked for with PathService::submit
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct PathRequest
+{
+	int ticket; //handed back by submit, used to collect the path
+	Node* begin; //the node the path starts at
+	Node* end; //the node the path ends on
+};
+
+/*
+* struct PathRequestGroup
+*
+* every request of one update that shares an end node, they are all
+* answered by a single search outwards from the end
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct PathRequestGroup
+{
+	Node* end = nullptr; //the node every path in the group ends on
+	std::vector<Node*> begins; //the start of each request
+	std::vector<int> tickets; //the ticket of each request
+	std::vector<std::vector<Node*>> paths; //the path of each request, filled by the search
+	bool done = false; //false if the budget ran out before the group was searched
+};
+
+/*
+* struct PathServiceStats
+*
+* counters for the last PathService::update
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct PathServiceStats
+{
+	size_t requests = 0; //requests waiting when the update started
+	size_t searches = 0; //searches run, one for each end node
+	size_t deferred = 0; //requests left for the next update because the budget ran out
+};
+
+/*
+* class PathService
+*
+* answers path requests in batches instead of straight away. requests are
+* collected until the next update, requests that share an end node are searched
+* together and the groups are split between worker threads. the paths can be
+* collected with the request's ticket from then on, so a path asked for during
+* one frame arrives on a later one
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class PathService
+{
+public:
+
+	Path* path = nullptr; //the graph to search
+
+	float frameBudget = 0.002f; //seconds a worker can keep starting searches for in one update, a search that has started is always finished
+	PathServiceStats stats; //counters for the last update
+
+	ThreadPool* workers = nullptr; //threads the groups are split between, shared with whatever else uses them between updates. the groups are searched on the calling thread if it's null
+
+	/*
+	* PathService()
+	* default constructor
+	*/
+	PathService() {};
+
+	/*
+	* ~PathService()
+	* default destructor
+	*/
+	~PathService() {};
+
+	/*
+	* submit
+	*
+	* asks for the shortest path between two nodes, it is searched for in a later update
+	*
+	* @param Node* begin - the node to start the path at
+	* @param Node* end - the node to end the path on
+	* @returns int - the ticket to collect the path with
+	*/
+	int submit(Node* begin, Node* end);
+
+	/*
+	* collect
+	*
+	* takes the path of a request if it has been searched, the ticket is finished with after this
+	*
+	* @param int ticket - the ticket from submit
+	* @param std::vector<Node*>& result - given the path, in the same order as Path::calculatePath. empty if there was no path
+	* @returns bool - true if the path was ready, result is left alone if it wasn't
+	*/
+	bool collect(int ticket, std::vector<Node*>& result);
+
+	/*
+	* cancel
+	*
+	* drops a request, or its path if it was never collected
+	*
+	* @param int ticket - the ticket from submit
+	* @returns void
+	*/
+	void cancel(int ticket);
+
+	/*
+	* update
+	*
+	* groups the waiting requests by end node, oldest first, and searches the groups on the
+	* worker threads until the budget runs out. groups that weren't reached wait for the next update.
+	* if the path is tree shaped every request walks the tree with calculateTreePath instead of searching
+	*
+	* @returns void
+	*/
+	void update();
+
+protected:
+
+	int nextTicket = 0; //the ticket the next request gets
+
+	std::vector<PathRequest> pending; //requests that haven't been searched, oldest first
+	std::unordered_map<int, std::vector<Node*>> finished; //searched paths waiting to be collected, by ticket
+
+	std::vector<PathRequestGroup> groups; //the groups of the current update, kept between updates so their memory is reused
+	size_t groupCount = 0; //how many of groups are in use
+	std::unordered_map<Node*, size_t> groupIndices; //the group of each end node while the groups are built
+};
@@ -1,4 +1,5 @@
 #include "physics.h"
+#include <math.h>
 
 //get a pointer to the singleton
 PhysicsSolver* PhysicsSolver::getInstance()
@@ -15,8 +16,8 @@ PhysicsSolver* PhysicsSolver::getInstance()
 	return singleton;
 }
 
-//updates velocities by calculating a collision
-void PhysicsSolver::applyImpulse(AdvancedCollision coll)
+//turn a collision into a contact for the next solve
+void PhysicsSolver::addContact(const AdvancedCollision& coll)
 {
 	//if the bodies both have infinite mass, don't apply impulses to them
 	if (coll.A->invMass == 0 && coll.B->invMass == 0)
@@ -24,61 +25,227 @@ void PhysicsSolver::applyImpulse(AdvancedCollision coll)
 		return;
 	}
 
-	//normal to the collision plane
-	Vector2 n = coll.normal;
+	ContactConstraint contact;
 
-	//normal to the collision points of both objects, used for converting rotational energy to linear energy
-	Vector2 rap = coll.A_contact.normal(NormalDirection::LEFT);
-	Vector2 rbp = coll.B_contact.normal(NormalDirection::LEFT);
+	contact.A = coll.A;
+	contact.B = coll.B;
+	contact.normal = coll.normal;
+	contact.tangent = contact.normal.normal(NormalDirection::LEFT);
+	contact.pointCount = coll.contactCount;
 
-	//relative velocity of the points that collided (takes angular velocity into account)
-	Vector2 rv = (coll.B->velocity + rbp * coll.B->angularVelocity) - (coll.A->velocity + rap * coll.A->angularVelocity);
+	for (int i = 0; i < coll.contactCount; i++)
+	{
+		contact.points[i].A_contact = coll.contacts[i].A_contact;
+		contact.points[i].B_contact = coll.contacts[i].B_contact;
+		contact.points[i].penetration = coll.contacts[i].penetration;
+		contact.points[i].impulse.id = coll.contacts[i].id;
+	}
 
-	//combined bounciness of the two bodies
-	float e = coll.A->restitution * coll.B->restitution;
+	contacts.push_back(contact);
+}
 
-	//simplifys the calculation of the inverted mass sum
-	float rapdN = rap.dot(n);
-	float rbpdN = rbp.dot(n);
+//solve the velocities, then the positions, then keep the impulses for next update
+void PhysicsSolver::solve(float deltaTime)
+{
+	size_t contactsSize = contacts.size();
+
+	for (size_t i = 0; i < contactsSize; i++)
+	{
+		prepareContact(contacts[i]);
+	}
 
-	float invSum = coll.A->invMass + coll.B->invMass + rapdN * rapdN * coll.A->invInertia + rbpdN * rbpdN * coll.B->invInertia;
+	//every pass moves the contacts closer to agreeing with each other
+	for (int iteration = 0; iteration < iterations; iteration++)
+	{
+		for (size_t i = 0; i < contactsSize; i++)
+		{
+			solveContact(contacts[i]);
+		}
+	}
 
-	//impulse scalar, when 'e' == 1, n * j is identical to the reflection formula
-	float j = -(1 + e) *  rv.dot(n);
-	j /= invSum;
+	//contacts that didn't happen this update are forgotten
+	contactCache.clear();
 
-	Vector2 impulse = n * j;
+	for (size_t i = 0; i < contactsSize; i++)
+	{
+		CachedManifold& cached = contactCache[EntityPair{ contacts[i].A, contacts[i].B }];
 
-	//linear
-	coll.A->velocity += impulse * -1.0f * coll.A->invMass;
-	coll.B->velocity += impulse * coll.B->invMass;
+		cached.pointCount = contacts[i].pointCount;
 
-	//angular
-	coll.A->angularVelocity += rap.dot(impulse * -1.0f) * coll.A->invInertia;
-	coll.B->angularVelocity += rbp.dot(impulse) * coll.B->invInertia;
+		for (int j = 0; j < contacts[i].pointCount; j++)
+		{
+			cached.points[j] = contacts[i].points[j].impulse;
+		}
+	}
 
-	//recalculate relative velocity for friction
-	rv = (coll.B->velocity + rbp * coll.B->angularVelocity) - (coll.A->velocity + rap * coll.A->angularVelocity);
+	//the furthest any contact can be pushed apart this update
+	float maxCorrection = maxCorrectionSpeed * deltaTime;
+
+	//push the bodies apart using a ratio of the masses so heavier bodies move less
+	for (size_t i = 0; i < contactsSize; i++)
+	{
+		ContactConstraint& contact = contacts[i];
+
+		//the deepest point decides how far, the points of a manifold share the normal
+		float penetration = 0.0f;
+
+		for (int j = 0; j < contact.pointCount; j++)
+		{
+			penetration = fmaxf(penetration, contact.points[j].penetration);
+		}
+
+		float correction = penetration - penetrationSlop;
+
+		if (correction <= 0)
+		{
+			continue;
+		}
+
+		float invMassSum = contact.A->invMass + contact.B->invMass;
+		Vector2 push = contact.normal * (fminf(correction * positionCorrection, maxCorrection) / invMassSum);
+
+		if (contact.A->invMass > 0)
+		{
+			contact.A->collider->transform.translation += push * -contact.A->invMass;
+
+			//update the matrices, a change was made
+			contact.A->collider->transform.updateGlobalTransform();
+			contact.A->collider->transform.updateChildren();
+		}
+
+		if (contact.B->invMass > 0)
+		{
+			contact.B->collider->transform.translation += push * contact.B->invMass;
+
+			//update the matrices, a change was made
+			contact.B->collider->transform.updateGlobalTransform();
+			contact.B->collider->transform.updateChildren();
+		}
+	}
+
+	contacts.clear();
+}
 
-	//get the velocity that moving along the collision plane
-	Vector2 t = rv - (n * rv.dot(n));
-	t.normalise();
+//effective masses, bounce and warm starting of every point
+void PhysicsSolver::prepareContact(ContactConstraint& contact)
+{
+	BaseEntity* A = contact.A;
+	BaseEntity* B = contact.B;
 
 	//combined friction
-	float mu = sqrtf(coll.A->friction * coll.A->friction + coll.B->friction * coll.B->friction);
+	contact.friction = sqrtf(A->friction * A->friction + B->friction * B->friction);
+
+	//combined bounciness of the two bodies
+	float e = A->restitution * B->restitution;
+
+	auto cached = contactCache.find(EntityPair{ A, B });
+
+	for (int i = 0; i < contact.pointCount; i++)
+	{
+		ContactConstraintPoint& point = contact.points[i];
+
+		//normal to the collision points of both objects, used for converting rotational energy to linear energy
+		Vector2 rap = point.A_contact.normal(NormalDirection::LEFT);
+		Vector2 rbp = point.B_contact.normal(NormalDirection::LEFT);
+
+		float rapdN = rap.dot(contact.normal);
+		float rbpdN = rbp.dot(contact.normal);
+		float rapdT = rap.dot(contact.tangent);
+		float rbpdT = rbp.dot(contact.tangent);
+
+		float normalSum = A->invMass + B->invMass + rapdN * rapdN * A->invInertia + rbpdN * rbpdN * B->invInertia;
+		float tangentSum = A->invMass + B->invMass + rapdT * rapdT * A->invInertia + rbpdT * rbpdT * B->invInertia;
+
+		point.normalMass = normalSum > 0 ? 1.0f / normalSum : 0.0f;
+		point.tangentMass = tangentSum > 0 ? 1.0f / tangentSum : 0.0f;
+
+		//relative velocity of the points that collided (takes angular velocity into account)
+		Vector2 rv = (B->velocity + rbp * B->angularVelocity) - (A->velocity + rap * A->angularVelocity);
+		float closing = rv.dot(contact.normal);
+
+		//slow contacts don't bounce so resting bodies stay at rest
+		point.velocityBias = closing < -restitutionThreshold ? -e * closing : 0.0f;
+
+		if (cached == contactCache.end())
+		{
+			continue;
+		}
+
+		//start from the impulses the same point ended with last update
+		for (int j = 0; j < cached->second.pointCount; j++)
+		{
+			if (cached->second.points[j].id == point.impulse.id)
+			{
+				point.impulse = cached->second.points[j];
+
+				applyContactImpulse(contact, point, contact.normal * point.impulse.normalImpulse + contact.tangent * point.impulse.tangentImpulse);
+				break;
+			}
+		}
+	}
+}
+
+//one pass of the normal and friction impulses for every point of a contact
+void PhysicsSolver::solveContact(ContactConstraint& contact)
+{
+	BaseEntity* A = contact.A;
+	BaseEntity* B = contact.B;
+
+	for (int i = 0; i < contact.pointCount; i++)
+	{
+		ContactConstraintPoint& point = contact.points[i];
+
+		Vector2 rap = point.A_contact.normal(NormalDirection::LEFT);
+		Vector2 rbp = point.B_contact.normal(NormalDirection::LEFT);
+
+		//relative velocity of the points that collided (takes angular velocity into account)
+		Vector2 rv = (B->velocity + rbp * B->angularVelocity) - (A->velocity + rap * A->angularVelocity);
 
-	//friction impulse scalar, negated as friction opposes movement
-	float jt = -rv.dot(t);
-	jt /= invSum;
+		//impulse needed to reach the target separating speed
+		float j = (point.velocityBias - rv.dot(contact.normal)) * point.normalMass;
 
-	Vector2 frictionImpulse = t * jt * mu;
+		//the total can only push the bodies apart, never pull them together
+		float oldNormal = point.impulse.normalImpulse;
+		point.impulse.normalImpulse = fmaxf(oldNormal + j, 0.0f);
+		j = point.impulse.normalImpulse - oldNormal;
+
+		applyContactImpulse(contact, point, contact.normal * j);
+	}
+
+	for (int i = 0; i < contact.pointCount; i++)
+	{
+		ContactConstraintPoint& point = contact.points[i];
+
+		Vector2 rap = point.A_contact.normal(NormalDirection::LEFT);
+		Vector2 rbp = point.B_contact.normal(NormalDirection::LEFT);
+
+		//recalculate relative velocity for friction
+		Vector2 rv = (B->velocity + rbp * B->angularVelocity) - (A->velocity + rap * A->angularVelocity);
+
+		//friction impulse scalar, negated as friction opposes movement
+		float jt = -rv.dot(contact.tangent) * point.tangentMass;
+
+		//friction can't be stronger than the normal impulse allows
+		float maxFriction = contact.friction * point.impulse.normalImpulse;
+		float oldTangent = point.impulse.tangentImpulse;
+		point.impulse.tangentImpulse = fmaxf(-maxFriction, fminf(oldTangent + jt, maxFriction));
+		jt = point.impulse.tangentImpulse - oldTangent;
+
+		applyContactImpulse(contact, point, contact.tangent * jt);
+	}
+}
+
+//equal and opposite impulses at the contact point
+void PhysicsSolver::applyContactImpulse(ContactConstraint& contact, ContactConstraintPoint& point, Vector2 impulse)
+{
+	Vector2 rap = point.A_contact.normal(NormalDirection::LEFT);
+	Vector2 rbp = point.B_contact.normal(NormalDirection::LEFT);
 
 	//linear
-	coll.A->velocity += frictionImpulse * -1.0f * coll.A->invMass;
-	coll.B->velocity += frictionImpulse * coll.B->invMass;
+	contact.A->velocity += impulse * -1.0f * contact.A->invMass;
+	contact.B->velocity += impulse * contact.B->invMass;
 
 	//angular
-	coll.A->angularVelocity += rap.dot(frictionImpulse * -1.0f) * coll.A->invInertia;
-	coll.B->angularVelocity += rbp.dot(frictionImpulse) * coll.B->invInertia;
-
+	contact.A->angularVelocity += rap.dot(impulse * -1.0f) * contact.A->invInertia;
+	contact.B->angularVelocity += rbp.dot(impulse) * contact.B->invInertia;
 }
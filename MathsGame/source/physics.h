@@ -1,15 +1,92 @@
 #pragma once
+#include <vector>
+#include <unordered_map>
 #include "collision.h"
 
 //macro that defines the instance with a name
 #define PHYS_SOLVER PhysicsSolver::getInstance()
 
+/*
+* struct ContactImpulse
+*
+* the impulses a contact point built up over the last update, used to warm start
+* the same point on the next update
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct ContactImpulse
+{
+	unsigned int id = 0; //the ContactPoint id the impulses belong to
+	float normalImpulse = 0.0f; //total impulse along the normal
+	float tangentImpulse = 0.0f; //total friction impulse along the tangent
+};
+
+/*
+* struct CachedManifold
+*
+* the impulses of every point of a manifold from the last update
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct CachedManifold
+{
+	ContactImpulse points[MAX_MANIFOLD_POINTS]; //impulses of each point
+	int pointCount = 0; //how many of the points are used
+};
+
+/*
+* struct ContactConstraintPoint
+*
+* one point of a ContactConstraint
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct ContactConstraintPoint
+{
+	Vector2 A_contact; //contact point relative to A
+	Vector2 B_contact; //contact point relative to B
+	float penetration = 0.0f; //how far the bodies overlap at this point, along the normal
+
+	float normalMass = 0.0f; //inverse of the effective mass along the normal
+	float tangentMass = 0.0f; //inverse of the effective mass along the tangent
+	float velocityBias = 0.0f; //separating speed the normal impulse aims for, from restitution
+
+	ContactImpulse impulse; //impulses applied so far, never negative along the normal
+};
+
+/*
+* struct ContactConstraint
+*
+* a contact manifold between two bodies that the solver keeps apart
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct ContactConstraint
+{
+	BaseEntity* A; //the first body
+	BaseEntity* B; //the second body
+
+	Vector2 normal; //direction from A to B
+	Vector2 tangent; //direction along the contact, the normal turned left
+	float friction = 0.0f; //combined friction of the two bodies
+
+	ContactConstraintPoint points[MAX_MANIFOLD_POINTS]; //the points of the manifold
+	int pointCount = 0; //how many of the points are used
+};
+
 /*
 * class PhysicsSolver
 *
 * a singleton class that calculates the resulting changes in velocity
 * and angular velocity that result from gravity, collisions or other forces
 *
+* contacts are solved together with sequential impulses, every contact is
+* visited several times and the total impulse of each is clamped so it only
+* ever pushes. the totals are kept between updates so the next update can
+* start from them (warm starting), resting piles settle in a few updates
+* instead of bouncing between one-shot impulses.
+* http://box2d.org/files/GDC2006/GDC2006_Catto_Erin_PhysicsForGame.ppt
+*
 * author: Bradley Booth, Academy of Interactive Entertainment, 2017
 */
 class PhysicsSolver
@@ -26,19 +103,75 @@ public:
 	*/
 	static PhysicsSolver* getInstance();
 
+	int iterations = 8; //how many times every contact is solved each update
+	float positionCorrection = 0.8f; //fraction of the penetration past the slop removed each update
+	float penetrationSlop = 0.05f; //penetration left alone so resting contacts stay touching
+	float maxCorrectionSpeed = 600.0f; //units per second the push can separate two bodies at, deeply buried bodies are eased apart over several updates instead of popping out
+	float restitutionThreshold = 10.0f; //contacts closing slower than this don't bounce
+
+	/*
+	* addContact
+	*
+	* adds a collision with its contact points to the contacts solved by the next call to solve
+	*
+	* @param const AdvancedCollision& coll - the collision, after calculateContacts
+	* @returns void
+	*/
+	void addContact(const AdvancedCollision& coll);
+
 	/*
-	* applyImpulse
+	* solve
 	*
-	* uses information about a collision to update the two object's velocities
-	* the objects are accessed as pointers from the AdvancedCollision argument
+	* solves every added contact. the velocities are solved first with
+	* warm starting from the last update, then the bodies are pushed apart
+	* by their penetration. the velocities aren't changed by the push, so
+	* correcting the penetration can't make the bodies fly apart.
+	* the contacts are cleared afterwards
 	*
-	* @param AdvancedCollision coll - the collision data to calculate the impulses from
+	* @param float deltaTime - amount of time passed since the last frame, limits how far the bodies are pushed
 	* @returns void
 	*/
-	void applyImpulse(AdvancedCollision coll);
+	void solve(float deltaTime);
 
 protected:
 
+	std::vector<ContactConstraint> contacts; //contacts added since the last solve
+	std::unordered_map<EntityPair, CachedManifold, EntityPairHash> contactCache; //impulses of last update's manifolds, for warm starting
+
+	/*
+	* prepareContact
+	*
+	* calculates the effective masses and bounce of each point of a contact and applies
+	* the impulses the points with the same ids had last update
+	*
+	* @param ContactConstraint& contact - the contact to prepare
+	* @returns void
+	*/
+	void prepareContact(ContactConstraint& contact);
+
+	/*
+	* solveContact
+	*
+	* applies the change in impulse that stops the contact's bodies moving into each other
+	* at every point, then the friction impulses, keeping the totals within their limits
+	*
+	* @param ContactConstraint& contact - the contact to solve
+	* @returns void
+	*/
+	void solveContact(ContactConstraint& contact);
+
+	/*
+	* applyContactImpulse
+	*
+	* applies an impulse to both bodies at a contact point, B is pushed along it and A the opposite way
+	*
+	* @param ContactConstraint& contact - the contact the impulse acts through
+	* @param ContactConstraintPoint& point - the point the impulse acts at
+	* @param Vector2 impulse - the impulse on B
+	* @returns void
+	*/
+	void applyContactImpulse(ContactConstraint& contact, ContactConstraintPoint& point, Vector2 impulse);
+
 	//as per the singleton structure
 
 	/*
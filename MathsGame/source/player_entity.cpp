@@ -94,9 +94,7 @@ void PlayerEntity::update(float deltaTime, Application2D* appPtr)
 	Vector2 mouse = Vector2{ (float)input->getMouseX(), (float)input->getMouseY() };
 	Vector2 mousePos = appPtr->m_camera + mouse;
 
-	Matrix3 globalMatrix = collider->transform.globalTransform;
-
-	Vector2 relDir = (mousePos - Vector2{ globalMatrix[2][0], globalMatrix[2][1] }).normalised();
+	Vector2 relDir = (mousePos - collider->transform.globalTransform.getTranslation()).normalised();
 
 	Matrix3 invRotation;
 	invRotation.identity();
@@ -105,7 +103,7 @@ void PlayerEntity::update(float deltaTime, Application2D* appPtr)
 
 	if (collider->transform.parent != nullptr)
 	{
-		Vector2 rotationTarget = (Vector3{ 0,1,0 } * collider->transform.parent->globalTransform);
+		Vector2 rotationTarget = collider->transform.parent->globalTransform.transformVector(Vector2{ 0,1 });
 		invRotation.setRotateZ(-rotationTarget.getRotation());
 	}
 
@@ -138,9 +136,10 @@ void PlayerEntity::update(float deltaTime, Application2D* appPtr)
 		}
 	}
 
-	//if left shift is pressed
-	if (input->wasKeyPressed(aie::INPUT_KEY_LEFT_SHIFT))
+	//if left shift was pressed since the last step that used it
+	if (appPtr->interactPressed)
 	{
+		appPtr->interactPressed = false;
 
 		//test the position of the click for a car
 		Circle click = Circle{ 5.0f };
@@ -285,10 +284,9 @@ void PlayerEntity::render(Application2D* appPtr)
 {
 	//the rotation occurs from the top-left corner
 	//use another matrix to force entities to rotate from the centre
-	Matrix3 correction = Matrix3{};
-	correction.identity();
+	Affine2 correction = Affine2{};
 	correction[2][0] = playerTexture->getWidth() / -2.0f;
 	correction[2][1] = playerTexture->getHeight() / -2.0f;
 
-	appPtr->m_2dRenderer->drawSpriteTransformed3x3(playerTexture, collider->transform.globalTransform * correction, 0.0f, 0.0f, -0.9f, 0.0f, 0.0f);
+	appPtr->m_2dRenderer->drawSpriteTransformed3x3(playerTexture, Matrix3(appPtr->world.renderTransform(collider->transform) * correction), 0.0f, 0.0f, -0.9f, 0.0f, 0.0f);
 }
@@ -13,9 +13,10 @@ Point::Point(Vector2 _position)
 //dot product of the point
 Range Point::project(Vector2 axis)
 {
+	updateWorldGeometry();
 
-	//transform the point
-	Vector2 positionTra = (Vector3(position.x, position.y, 1) * transform.globalTransform).GetXY();
+	//the transformed point
+	Vector2 positionTra = worldPoints[0];
 
 	//normalise the axis
 	Vector2 axisNorm = axis.normalised();
@@ -39,11 +40,8 @@ std::vector<Vector2> Point::getPoints()
 //closest point in any given direction for a point is itself
 std::vector<Vector2> Point::support(Vector2 normal)
 {
-	//get the global transformation matrix without translation
-	Matrix3 globalInvTrans = transform.globalTransform;
-	globalInvTrans.setTranslate(Vector2{ 0,0 });
-
-	return std::vector<Vector2>{globalInvTrans * (Vector3)position};
+	//apply the global transformation without translation
+	return std::vector<Vector2>{transform.globalTransform.transformVector(position)};
 }
 
 float Point::momentOfInertia(float mass)
@@ -51,28 +49,23 @@ float Point::momentOfInertia(float mass)
 	return mass * position.sqrMagnitude();
 }
 
-//create an aabb that encapsulates the shape
-void Point::generateHull()
+//transform the point and hull into world space
+void Point::calculateWorldGeometry()
 {
-	if (hull != nullptr)
-	{
-		delete hull;
-	}
-
-	Range xRange = project(Vector2{ 1,0 });
-	Range yRange = project(Vector2{ 0,1 });
+	worldPoints.resize(1);
+	worldPoints[0] = transform.globalTransform.transformPoint(position);
 
-	Vector2 min = Vector2{ xRange.min, yRange.min };
-	Vector2 max = Vector2{ xRange.max, yRange.max };
+	//a point has no sides to test
+	worldAxes.clear();
 
-	hull = new AABB{ min, max };
+	fitHullToPoints();
 }
 
 //render the point
 void Point::render(Application2D* app)
 {
 	//transform the point
-	Vector2 positionTra = (transform.globalTransform * Vector3(position.x, position.y, 1)).GetXY();
+	Vector2 positionTra = transform.globalTransform.transformPoint(Vector2{ position.x, position.y });
 
 	app->m_2dRenderer->drawCircle(positionTra.x, positionTra.y, 5.0f, 0.0f);
 }
@@ -43,11 +43,10 @@ public:
 	* calculates the axis to test with a Point
 	*
 	* @param Collider& other - the other shape in the collision test, this is necessary for circles
-	* @returns std::vector<Vector2> - an empty vector, a point has no axes to test
+	* @param AxisBuffer& axes - the list to add the axes to, a point has no axes so it is left as is
+	* @returns void
 	*/
-	std::vector<Vector2> getAxes(Collider& other) override {
-		return std::vector<Vector2>{};
-	}
+	void getAxes(Collider& other, AxisBuffer& axes) override {}
 
 	/*
 	* project
@@ -93,13 +92,13 @@ public:
 	float momentOfInertia(float mass) override;
 
 	/*
-	* generateHull
-	* overrides Collider's generateHull()
+	* calculateWorldGeometry
+	* overrides Collider's calculateWorldGeometry()
 	*
-	* calculates the minimum AABB that contains the shape
+	* transforms the point into world space and sizes the hull around it
 	* @returns void
 	*/
-	void generateHull() override;
+	void calculateWorldGeometry() override;
 
 	/*
 	* render
@@ -9,40 +9,31 @@ Polygon::Polygon(std::vector<Vector2> _points)
 {
 	colliderType = BoundsType::POLYGON;
 	points = _points;
+
+	//every side is an axis, they have to fit in the SAT test's fixed buffer
+	assert(points.size() <= MAX_SHAPE_AXES);
 }
 
 //gets all of the projection axes of the polygon
-std::vector<Vector2> Polygon::getAxes(Collider& other)
+void Polygon::getAxes(Collider& other, AxisBuffer& axes)
 {
+	updateWorldGeometry();
 
-	std::vector<Vector2> axes;
+	size_t size = worldAxes.size();
 
-	size_t size = points.size();
 	for (size_t i = 0; i < size; i++)
 	{
-		Vector2 nextTra = (Vector3(points[(i + 1) % size].x, points[(i + 1) % size].y, 1) * transform.globalTransform).GetXY();
-		Vector2 currentTra = (Vector3(points[i].x, points[i].y, 1) * transform.globalTransform).GetXY();
-
-		//get the normal vector of the side formed by two points
-		Vector2 normal = (nextTra - currentTra).normalised().normal(NormalDirection::LEFT);
-		axes.push_back(normal);
+		axes.push(worldAxes[i]);
 	}
-
-	return axes;
 }
 
 //get the smallest and largest dot products of the polygon to the axis
 Range Polygon::project(Vector2 axis)
 {
+	updateWorldGeometry();
 
-	std::vector<Vector2> axes;
-
-	size_t size = points.size();
-	for (size_t i = 0; i < size; i++)
-	{
-		Vector2 pointTra = (Vector3(points[i].x, points[i].y, 1) * transform.globalTransform).GetXY();
-		axes.push_back(pointTra);
-	}
+	std::vector<Vector2>& axes = worldPoints;
+	size_t size = axes.size();
 
 	Vector2 axisNorm = axis.normalised();
 
@@ -83,18 +74,17 @@ std::vector<Vector2> Polygon::getPoints()
 //get furthest point/s in a given direction
 std::vector<Vector2> Polygon::support(Vector2 normal)
 {
-	//get the global transformation matrix without translation
-	Matrix3 globalInvTrans = transform.globalTransform;
-	globalInvTrans[2][0] = 0;
-	globalInvTrans[2][1] = 0;
+	updateWorldGeometry();
 
-	std::vector<Vector2> axes;
+	size_t size = worldPoints.size();
+
+	//the cached world points without translation
+	Vector2 translation = transform.globalTransform.getTranslation();
+	std::vector<Vector2> axes(size);
 
-	size_t size = points.size();
 	for (size_t i = 0; i < size; i++)
 	{
-		Vector2 pointTra = (Vector3(points[i].x, points[i].y, 1) * globalInvTrans).GetXY();
-		axes.push_back(pointTra);
+		axes[i] = worldPoints[i] - translation;
 	}
 
 	std::vector<Vector2> bestList;
@@ -144,34 +134,43 @@ float Polygon::momentOfInertia(float mass)
 	return mass * bestSqr;
 }
 
-//create an aabb that encapsulates the shape
-void Polygon::generateHull()
+//transform the points, side normals and hull into world space
+void Polygon::calculateWorldGeometry()
 {
-	if (hull != nullptr)
-	{
-		delete hull;
-	}
+	size_t size = points.size();
 
-	Range xRange = project(Vector2{ 1,0 });
-	Range yRange = project(Vector2{ 0,1 });
+	//transform every point once, each one is shared by two sides
+	worldPoints.resize(size);
+	transform.globalTransform.transformPoints(points.data(), worldPoints.data(), size);
 
-	Vector2 min = Vector2{ xRange.min, yRange.min };
-	Vector2 max = Vector2{ xRange.max, yRange.max };
+	worldAxes.resize(size);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		Vector2 nextTra = worldPoints[(i + 1) % size];
+		Vector2 currentTra = worldPoints[i];
 
-	hull = new AABB{ min, max };
+		//get the normal vector of the side formed by two points
+		worldAxes[i] = (nextTra - currentTra).normalised().normal(NormalDirection::LEFT);
+	}
+
+	fitHullToPoints();
 }
 
 //render the shape
 void Polygon::render(Application2D* app)
 {
 
-	size_t size = points.size();
+	updateWorldGeometry();
+
+	std::vector<Vector2>& pointsTra = worldPoints;
+	size_t size = pointsTra.size();
 
 	//draw lines connecting all of the points
 	for (size_t i = 0; i < size; i++)
 	{
-		Vector2 point1Tra = (transform.globalTransform * Vector3(points[i].x ,points[i].y, 1)).GetXY();
-		Vector2 point2Tra = (transform.globalTransform * Vector3(points[(i + 1) % size].x, points[(i + 1) % size].y, 1)).GetXY();
+		Vector2 point1Tra = pointsTra[i];
+		Vector2 point2Tra = pointsTra[(i + 1) % size];
 
 		app->m_2dRenderer->drawLine(point1Tra.x, point1Tra.y, point2Tra.x, point2Tra.y, 1.0f, 0.0f);
 	}
@@ -46,9 +46,10 @@ public:
 	* calculates all axes to test with a Polygon
 	*
 	* @param Collider& - the other shape in the collision test, this is necessary for circles
-	* @returns std::vector<Vector2> - returns a list of all the sides the points of the polygon form
+	* @param AxisBuffer& - the list to add the axes to
+	* @returns void
 	*/
-	std::vector<Vector2> getAxes(Collider&) override;
+	void getAxes(Collider&, AxisBuffer&) override;
 
 	/*
 	* project
@@ -94,13 +95,13 @@ public:
 	float momentOfInertia(float mass) override;
 
 	/*
-	* generateHull
-	* overrides Collider's generateHull()
+	* calculateWorldGeometry
+	* overrides Collider's calculateWorldGeometry()
 	*
-	* calculates the minimum AABB that contains the shape
+	* transforms the points into world space and sizes the hull around it
 	* @returns void
 	*/
-	void generateHull() override;
+	void calculateWorldGeometry() override;
 
 	/*
 	* render
@@ -1,5 +1,7 @@
 #pragma once
 #include <vector>
+#include <thread>
+#include <string.h>
 
 //type that contains a value with the original index position that it had before being sorted
 template
@@ -10,54 +12,69 @@ struct IndexedItem
 	int index;
 };
 
+//ranges this small are finished off with insertion sort by quickSort and mergeSort
+#define SORTER_INSERTION_THRESHOLD 16
+
+//arrays smaller than this are sorted on the calling thread by parallelMergeSort
+#define SORTER_PARALLEL_THRESHOLD 65536
+
 /*
-* quickSort
+* insertionSort
 * template with typename T
 *
-* sorts an array of indexed items using quicksort
-* https://en.wikipedia.org/wiki/Quicksort
+* sorts part of an array of indexed items using insertion sort, every item is
+* moved backwards until the item before it isn't bigger. runs in O(n) when the
+* array is already nearly sorted, so it is the best choice for re-sorting
+* values that only changed slightly since the last sort
+* https://en.wikipedia.org/wiki/Insertion_sort
 *
-* @param std::vector<IndexedItem<T>> - the array of indexed items
-* @returns void
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @param int start - the first index of the range to sort
+* @param int end - the last index of the range to sort
+* @returns int - the number of items that were moved
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> quickSort(std::vector<IndexedItem<T>> arr)
+int insertionSort(std::vector<IndexedItem<T>>& arr, int start, int end)
 {
-	size_t size = arr.size();
-	quickSortRecursive<T>(&arr, 0, size - 1);
+	int moves = 0;
+
+	for (int i = start + 1; i <= end; i++)
+	{
+		IndexedItem<T> item = arr[i];
+		int j = i - 1;
 
-	return arr;
+		//shift bigger items forwards to make room
+		while (j >= start && arr[j].value > item.value)
+		{
+			arr[j + 1] = arr[j];
+			j--;
+		}
+
+		if (j + 1 != i)
+		{
+			arr[j + 1] = item;
+			moves++;
+		}
+	}
+
+	return moves;
 }
 
 /*
-* quickSortRecursive
+* insertionSort
 * template with typename T
 *
-* partitions an array recursively from the index start to the index end 
-* until the interval between start and end becomes too small to perform the operation
+* sorts an entire array of indexed items using insertion sort
 *
-* @param std::vector<IndexedItem<T>> arr - the array of indexed items
-* @param int start - the start of the range to apply the algorithm to
-* @param int end - the end of the range to apply the algorithm to
-* @returns std::vector<IndexedItem<T>> - the sorted array
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns int - the number of items that were moved
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> quickSortRecursive(std::vector<IndexedItem<T>>* arr, int start, int end)
+int insertionSort(std::vector<IndexedItem<T>>& arr)
 {
-	//check that the start and end points have items in between them
-	if (start >= end)
-	{
-		return;
-	}
-
-	int part = partition(&arr, start, end);
-
-	quickSortRecursive(arr, start, part - 1); //quick sort the lower half
-	quickSortRecursive(arr, part + 1, end); //quick sort the upper half
-
-	return arr;
+	return insertionSort<T>(arr, 0, (int)arr.size() - 1);
 }
 
 /*
@@ -67,51 +84,186 @@ std::vector<IndexedItem<T>> quickSortRecursive(std::vector<IndexedItem<T>>* arr,
 * a sub-algorithm of quicksort, modifies an array (from start to end)
 * so every number that proceeds the pivot is
 * lower than it and every number that follows the pivot is higher than it
-* the pivot will move, so it's new index is returned
+* the pivot is the median of the first, middle and last items, and it
+* will move, so it's new index is returned
 *
-* @param std::vector<IndexedItem<T>>* arr - the array of indexed items
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
 * @param int start - the start of the range to apply the algorithm to
 * @param int end - the end of the range to apply the algorithm to
 * @returns int - the new position of the pivot
 */
 template
 <typename T>
-int partition(std::vector<IndexedItem<T>>* arr, int start, int end)
+int partition(std::vector<IndexedItem<T>>& arr, int start, int end)
 {
-
-	int closed = start;
-	int open = start;
-
 	//define a variable to hold a temp when swapping
 	IndexedItem<T> temp = {};
 
-	//iterate from start to end
-	for (int i = start; i <= end; i++)
+	int middle = start + (end - start) / 2;
+
+	//order the first, middle and last items so the median is in the middle
+	if (arr[middle].value < arr[start].value)
+	{
+		temp = arr[middle]; arr[middle] = arr[start]; arr[start] = temp;
+	}
+	if (arr[end].value < arr[start].value)
+	{
+		temp = arr[end]; arr[end] = arr[start]; arr[start] = temp;
+	}
+	if (arr[end].value < arr[middle].value)
+	{
+		temp = arr[end]; arr[end] = arr[middle]; arr[middle] = temp;
+	}
+
+	//move the pivot to the end while the range is partitioned
+	temp = arr[middle]; arr[middle] = arr[end]; arr[end] = temp;
+
+	T pivot = arr[end].value;
+	int closed = start;
+
+	//iterate from start to end, moving every smaller item in front of the closed index
+	for (int i = start; i < end; i++)
 	{
-		//if the current value is higher than the starting value
-		if (arr[i].value > arr[start].value)
+		if (arr[i].value < pivot)
 		{
-			//swap it with the open value
 			temp = arr[i];
-			arr[i] = arr[open];
-			arr[open] = temp;
+			arr[i] = arr[closed];
+			arr[closed] = temp;
 
-			//the closed index becomes the open index
-			closed = open;
-
-			//the open index gets incremented
-			open++;
+			closed++;
 		}
 	}
 
-	//swap the last closed item with the starting item
+	//put the pivot between the two halves
 	temp = arr[closed];
-	arr[closed] = arr[start];
-	arr[start] = temp;
+	arr[closed] = arr[end];
+	arr[end] = temp;
 
 	return closed;
 }
 
+/*
+* quickSortRecursive
+* template with typename T
+*
+* partitions an array recursively from the index start to the index end
+* until the interval between start and end becomes small enough for insertion sort.
+* only the smaller half is recursed into, the larger half is looped over, so the
+* depth of recursion never goes past log2(n)
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
+* @param int start - the start of the range to apply the algorithm to
+* @param int end - the end of the range to apply the algorithm to
+* @returns void
+*/
+template
+<typename T>
+void quickSortRecursive(std::vector<IndexedItem<T>>& arr, int start, int end)
+{
+	//check that the start and end points have enough items in between them
+	while (end - start >= SORTER_INSERTION_THRESHOLD)
+	{
+		int part = partition<T>(arr, start, end);
+
+		//quick sort the smaller half, then carry on with the bigger half
+		if (part - start < end - part)
+		{
+			quickSortRecursive<T>(arr, start, part - 1);
+			start = part + 1;
+		}
+		else
+		{
+			quickSortRecursive<T>(arr, part + 1, end);
+			end = part - 1;
+		}
+	}
+
+	insertionSort<T>(arr, start, end);
+}
+
+/*
+* quickSort
+* template with typename T
+*
+* sorts an array of indexed items using quicksort
+* https://en.wikipedia.org/wiki/Quicksort
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
+*/
+template
+<typename T>
+void quickSort(std::vector<IndexedItem<T>>& arr)
+{
+	quickSortRecursive<T>(arr, 0, (int)arr.size() - 1);
+}
+
+/*
+* heapifyDown
+* template with typename T
+*
+* a O(log n) sub-algorithm of heapsort that moves an element from the
+* top of a sub-heap down to the bottom until it is bigger than both of its children
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
+* @param int root - the index of the element to move down
+* @param int len - the length of the heap
+* @returns void
+*/
+template
+<typename T>
+void heapifyDown(std::vector<IndexedItem<T>>& arr, int root, int len)
+{
+	IndexedItem<T> item = arr[root];
+
+	while (true)
+	{
+		int left = 2 * root + 1; //the left child in a heap structure
+		int right = left + 1; //the right child in a heap structure
+
+		if (left >= len)
+		{
+			break;
+		}
+
+		//pick the largest of the two children
+		int largest = right < len && arr[right].value > arr[left].value ? right : left;
+
+		//the item is in the right place
+		if (!(arr[largest].value > item.value))
+		{
+			break;
+		}
+
+		//move the child up and carry on from its position
+		arr[root] = arr[largest];
+		root = largest;
+	}
+
+	arr[root] = item;
+}
+
+/*
+* heapifyUp
+* template with typename T
+*
+* a O(n) sub-algorithm of heapsort that turns an array into a heap
+* by moving every parent down, starting from the bottom of the heap
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
+* @param int len - the length of the indexed items array to heapify
+* @returns void
+*/
+template
+<typename T>
+void heapifyUp(std::vector<IndexedItem<T>>& arr, int len)
+{
+	for (int i = len / 2 - 1; i >= 0; i--)
+	{
+		heapifyDown<T>(arr, i, len);
+	}
+}
+
 /*
 * heapSort
 * template with typename T
@@ -120,21 +272,20 @@ int partition(std::vector<IndexedItem<T>>* arr, int start, int end)
 * sifting the largest number from the tree and disgarding it in the next iteration
 * https://en.wikipedia.org/wiki/Heapsort
 *
-* @param std::vector<IndexedItem<T> arr - the array of indexed items
-* @returns std::vector<IndexedItem<T>> - the sorted array
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> heapSort(std::vector<IndexedItem<T>> arr)
+void heapSort(std::vector<IndexedItem<T>>& arr)
 {
-	//create
-	arr = heapifyUp<T>(arr, arr.size());
+	int size = (int)arr.size();
 
-	size_t size = arr.size();
+	//create
+	heapifyUp<T>(arr, size);
 
-	//transforms a heap into a sorted array by placing the smallest element (always the first in the heap) 
+	//transforms a heap into a sorted array by placing the largest element (always the first in the heap)
 	//at the back and then ignoring it in the next iteration
-
 	for (int i = size - 1; i > 0; i--)
 	{
 		//"delete" the first heap value (highest) by swapping it with the last and reheapifying the list without it
@@ -143,185 +294,342 @@ std::vector<IndexedItem<T>> heapSort(std::vector<IndexedItem<T>> arr)
 		arr[0] = temp;
 
 		//reheapify the heap
-		arr = heapifyDown<T>(arr, i);
+		heapifyDown<T>(arr, 0, i);
 	}
-
-	return arr;
 }
 
-
 /*
-* heapifyUp
+* shellSort
 * template with typename T
 *
-* a recursive O(n) sub-algorithm of heapsort that shifts elements
-* from the bottom of the heap to the top to achieve a heap structure
+* insertion sorts elements across a gap, the gap size decreases (/= 2) until
+* it reaches a size of 1, the algorithm behaves like insertion sort when the gap size = 1
+* https://en.wikipedia.org/wiki/Shellsort
 *
-* @param std::vector<IndexedItem<T>> arr - the array of indexed items
-* @param int len - the length of the indexed items array to heapify
-* @returns std::vector<IndexedItem<T>> - the new array heapified up
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> heapifyUp(std::vector<IndexedItem<T>> arr, int len)
+void shellSort(std::vector<IndexedItem<T>>& arr)
 {
-	bool swapped = false;
-	
-	for (int i = len / 2; i >= 1; i--)
-	{
-		int left = 2 * i; //the left child in a heap structure
-		int right = 2 * i + 1; //the right child in a heap structure
+	int len = (int)arr.size();
 
-		//check if there is a child node that is more than the current parent
-		//swap the nodes if this occurs
-		if (left < len && arr[left - 1].value > arr[i - 1].value)
+	//floor division
+	int gap = len / 2;
+
+	while (gap > 0)
+	{
+		//insertion sort every item with the items a multiple of gap before it
+		for (int i = gap; i < len; i++)
 		{
-			swapped = true;
+			IndexedItem<T> item = arr[i];
+			int j = i;
 
-			//swap the largest node out of the two children
-			if (right < len && arr[right - 1].value > arr[left - 1].value)
+			while (j >= gap && arr[j - gap].value > item.value)
 			{
-				IndexedItem<T> temp = arr[i - 1];
-				arr[i - 1] = arr[right - 1];
-				arr[right - 1] = temp;				
+				arr[j] = arr[j - gap];
+				j -= gap;
 			}
-			else
-			{
 
-				IndexedItem<T> temp = arr[i - 1];
-				arr[i - 1] = arr[left - 1];
-				arr[left - 1] = temp;
-			}
+			arr[j] = item;
 		}
-		else if (right < len && arr[right - 1].value > arr[i - 1].value)
+
+		//floor division
+		gap /= 2;
+	}
+}
+
+/*
+* radixKey
+*
+* converts a value into an unsigned integer that sorts in the same order
+* as the value when compared as bits
+*
+* @param unsigned int value - the value to convert
+* @returns unsigned int - the value
+*/
+inline unsigned int radixKey(unsigned int value)
+{
+	return value;
+}
+
+/*
+* radixKey
+*
+* converts a value into an unsigned integer that sorts in the same order
+* as the value when compared as bits, the sign bit is flipped so negative
+* numbers come first
+*
+* @param int value - the value to convert
+* @returns unsigned int - the converted value
+*/
+inline unsigned int radixKey(int value)
+{
+	return (unsigned int)value ^ 0x80000000u;
+}
+
+/*
+* radixKey
+*
+* converts a value into an unsigned integer that sorts in the same order
+* as the value when compared as bits. positive floats already sort correctly
+* once the sign bit is set, negative floats have every bit flipped so the
+* larger magnitudes come first
+* http://stereopsis.com/radix.html
+*
+* @param float value - the value to convert
+* @returns unsigned int - the converted value
+*/
+inline unsigned int radixKey(float value)
+{
+	unsigned int bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	unsigned int mask = (bits & 0x80000000u) ? 0xffffffffu : 0x80000000u;
+
+	return bits ^ mask;
+}
+
+/*
+* radixSort
+* template with typename T
+*
+* sorts an array of indexed items one byte of the key at a time, starting with the lowest byte.
+* each pass counts how many keys have each byte value and moves the items into a second array
+* in that order, so the sort is stable and runs in O(n) no matter how the items start.
+* T must have a radixKey overload (float, int or unsigned int)
+* https://en.wikipedia.org/wiki/Radix_sort
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @param std::vector<IndexedItem<T>>& scratch - memory for the passes, resized to fit and kept so it can be reused
+* @returns void
+*/
+template
+<typename T>
+void radixSort(std::vector<IndexedItem<T>>& arr, std::vector<IndexedItem<T>>& scratch)
+{
+	size_t len = arr.size();
+
+	if (len < 2)
+	{
+		return;
+	}
+
+	scratch.resize(len);
+
+	//count every byte of every key in one read of the array
+	size_t counts[4][256] = {};
+
+	for (size_t i = 0; i < len; i++)
+	{
+		unsigned int key = radixKey(arr[i].value);
+
+		counts[0][key & 0xff]++;
+		counts[1][(key >> 8) & 0xff]++;
+		counts[2][(key >> 16) & 0xff]++;
+		counts[3][key >> 24]++;
+	}
+
+	IndexedItem<T>* from = arr.data();
+	IndexedItem<T>* to = scratch.data();
+
+	for (int pass = 0; pass < 4; pass++)
+	{
+		int shift = pass * 8;
+
+		//every key has the same byte here, the pass wouldn't change anything
+		if (counts[pass][(radixKey(from[0].value) >> shift) & 0xff] == len)
 		{
+			continue;
+		}
+
+		//turn the counts into the first position of each byte value
+		size_t offsets[256];
+		size_t total = 0;
 
-			IndexedItem<T> temp = arr[i - 1];
-			arr[i - 1] = arr[right - 1];
-			arr[right - 1] = temp;
+		for (int b = 0; b < 256; b++)
+		{
+			offsets[b] = total;
+			total += counts[pass][b];
+		}
 
-			swapped = true;
+		for (size_t i = 0; i < len; i++)
+		{
+			to[offsets[(radixKey(from[i].value) >> shift) & 0xff]++] = from[i];
 		}
+
+		IndexedItem<T>* temp = from;
+		from = to;
+		to = temp;
 	}
 
-	//redo the heapify if there was a swap
-	if (swapped)
+	//an odd number of passes left the result in the scratch array
+	if (from != arr.data())
 	{
-		return heapifyUp(arr, len);
+		arr.swap(scratch);
 	}
-
-	return arr;
 }
 
 /*
-* heapifyDown
+* radixSort
 * template with typename T
 *
-* a recursive O(n) sub-algorithm of heapsort that shifts elements
-* from the top of the heap to the bottom to achieve a heap structure
+* sorts an array of indexed items using radix sort, with its own scratch memory
 *
-* @param std::vector<IndexedItem<T>> arr - the array of indexed items
-* @param int len - the length of the indexed items array
-* @returns std::vector<IndexedItem<T>> - the new array heapified up
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> heapifyDown(std::vector<IndexedItem<T>> arr, int len)
+void radixSort(std::vector<IndexedItem<T>>& arr)
 {
-	bool swapped = false;
+	std::vector<IndexedItem<T>> scratch;
+	radixSort<T>(arr, scratch);
+}
 
-	for (int i = 1; i <= len / 2; i++)
+/*
+* mergeRanges
+* template with typename T
+*
+* a sub-algorithm of merge sort, merges two sorted ranges next to each other
+* into one sorted range, the first range is copied out to the scratch memory first. when two items are equal the one from the first range
+* goes first, so the merge is stable
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
+* @param std::vector<IndexedItem<T>>& scratch - memory the size of arr to merge into
+* @param int start - the first index of the first range
+* @param int middle - the first index of the second range
+* @param int end - one past the last index of the second range
+* @returns void
+*/
+template
+<typename T>
+void mergeRanges(std::vector<IndexedItem<T>>& arr, std::vector<IndexedItem<T>>& scratch, int start, int middle, int end)
+{
+	//the ranges are already in order
+	if (!(arr[middle - 1].value > arr[middle].value))
 	{
-		int left = 2 * i; //left child node of the parent
-		int right = 2 * i + 1; //right child node of the parent
+		return;
+	}
 
-		//check if there a child node that is more than the current parent
-		//swap the nodes if this occurs
-		if (left < len && arr[left - 1].value > arr[i - 1].value)
-		{
-			swapped = true;
+	//only the first range is moved out of the way, the merge writes back over it
+	for (int i = start; i < middle; i++)
+	{
+		scratch[i] = arr[i];
+	}
 
-			//swap the largest node out of the two children
-			if (right < len && arr[right - 1].value > arr[left - 1].value)
-			{
-				IndexedItem<T> temp = arr[i - 1];
-				arr[i - 1] = arr[right - 1];
-				arr[right - 1] = temp;
-			}
-			else
-			{
+	int left = start;
+	int right = middle;
+	int write = start;
 
-				IndexedItem<T> temp = arr[i - 1];
-				arr[i - 1] = arr[left - 1];
-				arr[left - 1] = temp;
-			}
+	while (left < middle && right < end)
+	{
+		if (arr[right].value < scratch[left].value)
+		{
+			arr[write++] = arr[right++];
 		}
-		else if (right < len && arr[right - 1].value > arr[i - 1].value)
+		else
 		{
+			arr[write++] = scratch[left++];
+		}
+	}
 
-			IndexedItem<T> temp = arr[i - 1];
-			arr[i - 1] = arr[right - 1];
-			arr[right - 1] = temp;
+	//anything left in the second range is already in place
+	while (left < middle)
+	{
+		arr[write++] = scratch[left++];
+	}
+}
 
-			swapped = true;
-		}
+/*
+* mergeSortRecursive
+* template with typename T
+*
+* sorts both halves of a range then merges them. while depth is above 0 the first
+* half is sorted on a new thread at the same time as the second half
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items
+* @param std::vector<IndexedItem<T>>& scratch - memory the size of arr to merge into
+* @param int start - the first index of the range
+* @param int end - one past the last index of the range
+* @param int depth - how many more levels can start threads
+* @returns void
+*/
+template
+<typename T>
+void mergeSortRecursive(std::vector<IndexedItem<T>>& arr, std::vector<IndexedItem<T>>& scratch, int start, int end, int depth)
+{
+	if (end - start <= SORTER_INSERTION_THRESHOLD)
+	{
+		insertionSort<T>(arr, start, end - 1);
+		return;
 	}
 
-	//redo the heapify if there was a swap
-	if (swapped)
+	int middle = start + (end - start) / 2;
+
+	//the halves don't share any items, so they can be sorted at the same time
+	if (depth > 0)
+	{
+		std::thread firstHalf(mergeSortRecursive<T>, std::ref(arr), std::ref(scratch), start, middle, depth - 1);
+		mergeSortRecursive<T>(arr, scratch, middle, end, depth - 1);
+		firstHalf.join();
+	}
+	else
 	{
-		return heapifyUp(arr, len);
+		mergeSortRecursive<T>(arr, scratch, start, middle, 0);
+		mergeSortRecursive<T>(arr, scratch, middle, end, 0);
 	}
 
-	return arr;
+	mergeRanges<T>(arr, scratch, start, middle, end);
 }
 
 /*
-* shellSort
+* mergeSort
 * template with typename T
 *
-* observes elements across a gap and swaps them, the gap size decreases (/= 2) until
-* it reaches a size of 1, the algorithm behaves like insertion sort when the gap size = 1
-* https://en.wikipedia.org/wiki/Shellsort
+* sorts an array of indexed items using a stable merge sort on the calling thread
+* https://en.wikipedia.org/wiki/Merge_sort
 *
-* @param std::vector<IndexedItem<T>> arr - the array of indexed items
-* @returns std::vector<IndexedItem<T>> - the sorted array
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
 */
 template
 <typename T>
-std::vector<IndexedItem<T>> shellSort(std::vector<IndexedItem<T>> arr)
+void mergeSort(std::vector<IndexedItem<T>>& arr)
 {
-	//floor division
-	int gap = len / 2;
+	std::vector<IndexedItem<T>> scratch(arr.size());
+	mergeSortRecursive<T>(arr, scratch, 0, (int)arr.size(), 0);
+}
 
-	while (gap > 0)
+/*
+* parallelMergeSort
+* template with typename T
+*
+* sorts an array of indexed items using merge sort, splitting the work between
+* about as many threads as the hardware has. arrays smaller than
+* SORTER_PARALLEL_THRESHOLD aren't worth starting threads for and are sorted on the calling thread
+*
+* @param std::vector<IndexedItem<T>>& arr - the array of indexed items, sorted in place
+* @returns void
+*/
+template
+<typename T>
+void parallelMergeSort(std::vector<IndexedItem<T>>& arr)
+{
+	int depth = 0;
+
+	if (arr.size() >= SORTER_PARALLEL_THRESHOLD)
 	{
-		size_t size = arr.size();
-		//one pass occurs when end reaches the end of the lost
-		for (int end = 0; end < size; end++)
-		{
-			//tidier and easier to read
-			//start is the len rounded down to the nearest multiple of gap
-			int start = len + (gap - (len % gap));
+		//every level doubles the number of threads
+		unsigned int threads = std::thread::hardware_concurrency();
 
-			for (; start >= 0; start -= gap)
-			{
-				int first = start;
-				int other = start + gap;
-
-				//if checking a valid pair and the pair are not in order
-				if (other < len && arr[first].value > arr[other].value)
-				{
-					IndexedItem<T> temp = arr[first];
-					arr[first] = arr[other];
-					arr[other] = temp;
-				}
-			}
+		while ((1u << (depth + 1)) <= threads)
+		{
+			depth++;
 		}
-
-		//floor division
-		gap /= 2;
 	}
 
-	return arr;
+	std::vector<IndexedItem<T>> scratch(arr.size());
+	mergeSortRecursive<T>(arr, scratch, 0, (int)arr.size(), depth);
 }
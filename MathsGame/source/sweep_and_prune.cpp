@@ -0,0 +1,117 @@
+#include "sweep_and_prune.h"
+
+//add both edges of the hull to the end of the list, the next update sorts them in
+int SweepAndPrune::addProxy(BaseEntity* entity)
+{
+	int proxy = 0;
+
+	if (freeProxies.empty())
+	{
+		proxies.push_back(entity);
+		proxy = (int)proxies.size() - 1;
+	}
+	else
+	{
+		proxy = freeProxies.back();
+		freeProxies.pop_back();
+		proxies[proxy] = entity;
+	}
+
+	AABB* hull = entity->collider->hull;
+
+	endpoints.push_back(IndexedItem<float>{ hull->min.x, proxy * 2 });
+	endpoints.push_back(IndexedItem<float>{ hull->max.x, proxy * 2 + 1 });
+
+	return proxy;
+}
+
+//take both edges out of the list, the rest of the list stays sorted
+void SweepAndPrune::removeProxy(int proxy)
+{
+	size_t endpointsSize = endpoints.size();
+	size_t write = 0;
+
+	for (size_t i = 0; i < endpointsSize; i++)
+	{
+		if (endpoints[i].index / 2 != proxy)
+		{
+			endpoints[write++] = endpoints[i];
+		}
+	}
+
+	endpoints.resize(write);
+
+	proxies[proxy] = nullptr;
+	freeProxies.push_back(proxy);
+}
+
+//sort the edges along x, then sweep through them from left to right
+void SweepAndPrune::update()
+{
+	pairs.clear();
+	active.clear();
+
+	size_t endpointsSize = endpoints.size();
+
+	//the hulls have moved since the last update
+	for (size_t i = 0; i < endpointsSize; i++)
+	{
+		AABB* hull = proxies[endpoints[i].index / 2]->collider->hull;
+
+		endpoints[i].value = endpoints[i].index % 2 == 0 ? hull->min.x : hull->max.x;
+	}
+
+	//the order from the last update is almost right
+	sortMoves = (size_t)insertionSort<float>(endpoints);
+
+	for (size_t i = 0; i < endpointsSize; i++)
+	{
+		int proxy = endpoints[i].index / 2;
+
+		//right edge, the hull can't overlap anything further along
+		if (endpoints[i].index % 2 == 1)
+		{
+			size_t activeSize = active.size();
+
+			for (size_t j = 0; j < activeSize; j++)
+			{
+				if (active[j] == proxy)
+				{
+					active[j] = active.back();
+					active.pop_back();
+					break;
+				}
+			}
+
+			continue;
+		}
+
+		BaseEntity* entity = proxies[proxy];
+		AABB* hull = entity->collider->hull;
+
+		//left edge, the hull overlaps every active hull along x
+		size_t activeSize = active.size();
+
+		for (size_t j = 0; j < activeSize; j++)
+		{
+			BaseEntity* other = proxies[active[j]];
+
+			//walls can't collide with each other
+			if (entity->staticLayer && other->staticLayer)
+			{
+				continue;
+			}
+
+			AABB* otherHull = other->collider->hull;
+
+			if (hull->min.y > otherHull->max.y || otherHull->min.y > hull->max.y)
+			{
+				continue;
+			}
+
+			pairs.push_back(SweepAndPrunePair{ other, entity });
+		}
+
+		active.push_back(proxy);
+	}
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <vector>
+#include "base_entity.h"
+#include "sorter.h"
+
+//index used by the sweep for "no proxy"
+#define SWEEP_NULL -1
+
+/*
+* struct SweepAndPrunePair
+*
+* two entities whose hulls overlap, A's hull starts further left than B's.
+* the order only depends on where the hulls are, so it is the same every run
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+struct SweepAndPrunePair
+{
+	BaseEntity* A;
+	BaseEntity* B;
+};
+
+/*
+* class SweepAndPrune
+*
+* a sort and sweep broadphase, the left and right edge of every hull is kept
+* in one list sorted along the x axis. walking the list from left to right,
+* a hull overlaps every hull that started before it and hasn't ended yet,
+* so only those are checked along the y axis.
+*
+* entities only move a little every update, so the list from the last update is
+* nearly sorted and insertion sort puts it back in order in close to O(n)
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class SweepAndPrune
+{
+public:
+
+	std::vector<SweepAndPrunePair> pairs; //every pair of hulls that overlapped during the last update
+	size_t sortMoves = 0; //endpoints insertion sort had to move during the last update
+
+	/*
+	* SweepAndPrune()
+	* default constructor
+	*/
+	SweepAndPrune() {};
+
+	/*
+	* ~SweepAndPrune()
+	* default destructor, the sweep doesn't own the entities
+	*/
+	~SweepAndPrune() {};
+
+	/*
+	* addProxy
+	*
+	* adds an entity's hull to the sweep, the hull must already be generated
+	*
+	* @param BaseEntity* entity - the entity to add
+	* @returns int - the index of the proxy, used to remove it
+	*/
+	int addProxy(BaseEntity* entity);
+
+	/*
+	* removeProxy
+	*
+	* removes an entity's hull from the sweep
+	*
+	* @param int proxy - the index returned by addProxy
+	* @returns void
+	*/
+	void removeProxy(int proxy);
+
+	/*
+	* update
+	*
+	* reads every hull again, re-sorts the endpoints and fills pairs.
+	* pairs of two entities from the static layer are left out
+	*
+	* @returns void
+	*/
+	void update();
+
+	/*
+	* size
+	*
+	* gets the number of entities in the sweep
+	*
+	* @returns size_t - the number of proxies in use
+	*/
+	size_t size() { return proxies.size() - freeProxies.size(); };
+
+protected:
+
+	std::vector<BaseEntity*> proxies; //the entity of each proxy, nullptr if the proxy isn't in use
+	std::vector<int> freeProxies; //proxies that can be reused
+
+	std::vector<IndexedItem<float>> endpoints; //edges along the x axis, the index is proxy * 2 for the left edge and proxy * 2 + 1 for the right edge
+	std::vector<int> active; //proxies whose left edge has been passed but not their right edge, kept so its memory is reused
+};
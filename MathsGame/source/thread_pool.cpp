@@ -0,0 +1,143 @@
+#include "thread_pool.h"
+
+//stop the threads before the members they use go away
+ThreadPool::~ThreadPool()
+{
+	stopThreads();
+}
+
+//restart the pool with the new number of threads
+void ThreadPool::setThreadCount(unsigned int count)
+{
+	if (count == 0)
+	{
+		count = std::thread::hardware_concurrency();
+	}
+
+	if (count == 0)
+	{
+		count = 1;
+	}
+
+	if (count == getThreadCount())
+	{
+		return;
+	}
+
+	stopThreads();
+
+	for (unsigned int i = 1; i < count; i++)
+	{
+		threads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+	}
+}
+
+//hand out the blocks, run the first on this thread and wait for the rest
+void ThreadPool::parallelFor(size_t count, size_t minPerThread, const Job& work)
+{
+	if (minPerThread == 0)
+	{
+		minPerThread = 1;
+	}
+
+	size_t blocks = (count + minPerThread - 1) / minPerThread;
+
+	if (blocks > getThreadCount())
+	{
+		blocks = getThreadCount();
+	}
+
+	//not worth waking anyone
+	if (blocks <= 1)
+	{
+		work(0, count, 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		job = &work;
+		jobCount = count;
+		jobBlocks = (unsigned int)blocks;
+		remaining = jobBlocks - 1;
+		generation++;
+	}
+
+	wake.notify_all();
+
+	work(0, count / blocks, 0);
+
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return remaining == 0; });
+
+	job = nullptr;
+}
+
+//sleep until there is work, then run this worker's block
+void ThreadPool::workerLoop(unsigned int worker)
+{
+	unsigned int seen = 0;
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true)
+	{
+		wake.wait(lock, [this, &seen] { return stopping || generation != seen; });
+
+		if (stopping)
+		{
+			return;
+		}
+
+		seen = generation;
+
+		//the work was split into fewer blocks than there are threads
+		if (worker >= jobBlocks)
+		{
+			continue;
+		}
+
+		const Job* current = job;
+		size_t start = jobCount * worker / jobBlocks;
+		size_t end = jobCount * (worker + 1) / jobBlocks;
+
+		lock.unlock();
+		(*current)(start, end, worker);
+		lock.lock();
+
+		if (--remaining == 0)
+		{
+			finished.notify_one();
+		}
+	}
+}
+
+//tell every thread to exit and wait for them
+void ThreadPool::stopThreads()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+
+	wake.notify_all();
+
+	size_t threadsSize = threads.size();
+
+	for (size_t i = 0; i < threadsSize; i++)
+	{
+		threads[i].join();
+	}
+
+	threads.clear();
+	stopping = false;
+
+	//the next threads start from generation 0, so forget the last job or
+	//they would wake up straight away and run it
+	job = nullptr;
+	jobCount = 0;
+	jobBlocks = 0;
+	generation = 0;
+	remaining = 0;
+}
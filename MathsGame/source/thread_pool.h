@@ -0,0 +1,105 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+/*
+* class ThreadPool
+*
+* a set of threads that sleep until they are given a range of work to split.
+* the threads are started once and reused, so handing out work every
+* update doesn't pay for creating threads. the calling thread takes the
+* first part of the work itself and waits for the others to finish
+*
+* author: Bradley Booth, Academy of Interactive Entertainment, 2017
+*/
+class ThreadPool
+{
+public:
+
+	//a part of the work, from start up to (not including) end, run by the worker with the given index
+	typedef std::function<void(size_t start, size_t end, unsigned int worker)> Job;
+
+	/*
+	* ThreadPool()
+	* default constructor - only uses the calling thread until setThreadCount is called
+	*/
+	ThreadPool() {};
+
+	/*
+	* ~ThreadPool()
+	* destructor - wakes and joins every thread
+	*/
+	~ThreadPool();
+
+	/*
+	* setThreadCount
+	*
+	* changes how many threads the work is split between, including the calling thread.
+	* must not be called while parallelFor is running
+	*
+	* @param unsigned int count - number of threads, 0 uses one per hardware thread
+	* @returns void
+	*/
+	void setThreadCount(unsigned int count);
+
+	/*
+	* getThreadCount
+	*
+	* gets how many threads the work is split between, including the calling thread
+	*
+	* @returns unsigned int - number of threads
+	*/
+	unsigned int getThreadCount() { return (unsigned int)threads.size() + 1; };
+
+	/*
+	* parallelFor
+	*
+	* splits the indices from 0 to count into one block per thread and runs the job on every block.
+	* each block is the same every time for the same count and thread count, so work that writes
+	* to its own index gives the same result no matter how the threads are scheduled.
+	* returns once every block is done
+	*
+	* @param size_t count - number of indices
+	* @param size_t minPerThread - smallest block worth giving to a thread, fewer threads are used for small counts
+	* @param const Job& job - the function run on each block
+	* @returns void
+	*/
+	void parallelFor(size_t count, size_t minPerThread, const Job& job);
+
+protected:
+
+	std::vector<std::thread> threads; //the threads besides the calling thread, worker i + 1 runs on threads[i]
+
+	std::mutex mutex; //guards everything below
+	std::condition_variable wake; //signalled when there is new work or the threads should stop
+	std::condition_variable finished; //signalled when the last block is done
+
+	const Job* job = nullptr; //the work being run
+	size_t jobCount = 0; //number of indices in the work being run
+	unsigned int jobBlocks = 0; //number of blocks the work is split into
+	unsigned int generation = 0; //changes every time work is handed out
+	unsigned int remaining = 0; //blocks the other threads haven't finished
+	bool stopping = false; //true when the threads should exit
+
+	/*
+	* workerLoop
+	*
+	* waits for work and runs the worker's block of it until the pool is stopped
+	*
+	* @param unsigned int worker - the index of the worker, 1 or more
+	* @returns void
+	*/
+	void workerLoop(unsigned int worker);
+
+	/*
+	* stopThreads
+	*
+	* wakes and joins every thread
+	*
+	* @returns void
+	*/
+	void stopThreads();
+};
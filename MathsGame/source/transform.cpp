@@ -1,5 +1,11 @@
 #include "transform.h"
 
+#include <cmath>
+
+//every change of any transform gets a new stamp, so two different
+//global transformations can never share the same version
+static unsigned int versionCounter = 0;
+
 Transform::Transform()
 {
 	translation = Vector2{ 0,0 };
@@ -12,46 +18,27 @@ Transform::Transform()
 //creates a local transformation matrix out of translation, rotation and scale
 void Transform::updateLocalTransform()
 {
-	Matrix3 translationMatrix;
-	translationMatrix.setTranslate(translation);
-
-	Matrix3 rotationMatrix;
-	rotationMatrix.setRotateZ(rotation);
-
-	Matrix3 scaleMatrix;
-	scaleMatrix.setScale(scale);
-
 	//scale * rotation * translation (the desired order)
-	localTransform = translationMatrix * rotationMatrix * scaleMatrix;
+	localTransform.setTRS(translation, rotation, scale);
 }
 
 //creates a global transformation matrix out of position, rotation and scale recursively from all parents
 void Transform::updateGlobalTransform()
 {
-	Matrix3 translationMatrix;
-	translationMatrix.setTranslate(translation);
-
-	Matrix3 rotationMatrix;
-	rotationMatrix.setRotateZ(rotation);
-
-	Matrix3 scaleMatrix;
-	scaleMatrix.setScale(scale);
+	updateLocalTransform();
 
 	//if the transform has a parent
 	if (parent == nullptr)
 	{
-		//scale * rotation * translation (the desired order)
-		globalTransform = translationMatrix * rotationMatrix * scaleMatrix;
+		setGlobalTransform(localTransform);
 	}
 	else
 	{
 		parent->updateGlobalTransform();
 
 		//scale * rotation * translation * parent.... (the desired order)
-		globalTransform = parent->globalTransform * translationMatrix * rotationMatrix * scaleMatrix;
+		setGlobalTransform(parent->globalTransform * localTransform);
 	}
-
-	updateLocalTransform();
 }
 
 //updates all children's global transformation matrices recursively
@@ -64,23 +51,79 @@ void Transform::updateChildren()
 	{
 		Transform* child = children[i];
 
-		Matrix3 translationMatrix;
-		translationMatrix.setTranslate(child->translation);
-
-		Matrix3 rotationMatrix;
-		rotationMatrix.setRotateZ(child->rotation);
-
-		Matrix3 scaleMatrix;
-		scaleMatrix.setScale(child->scale);
+		child->updateLocalTransform();
 
 		//this transform * child's local transform
-		child->globalTransform = globalTransform * translationMatrix * rotationMatrix * scaleMatrix;
+		child->setGlobalTransform(globalTransform * child->localTransform);
 
 		//recursively apply the change to all transforms
 		child->updateChildren();
 	}
 }
 
+//assigns the global transformation, stamps a new version if it changed
+void Transform::setGlobalTransform(const Affine2& newTransform)
+{
+	if (globalTransform != newTransform)
+	{
+		globalTransform = newTransform;
+		version = ++versionCounter;
+	}
+}
+
+//remembers the global transformation from before the step
+void Transform::storePrevious(unsigned int step)
+{
+	previousTransform = globalTransform;
+	previousStep = step;
+}
+
+//blends the previous and current global transformations
+Affine2 Transform::getRenderTransform(unsigned int step, float alpha)
+{
+	//nothing to blend from, or nothing moved
+	if (previousStep != step || previousTransform == globalTransform)
+	{
+		return globalTransform;
+	}
+
+	Affine2 blended = Affine2{};
+
+	Vector2 previousX = previousTransform[0];
+	Vector2 currentX = globalTransform[0];
+
+	//the signed angle the x axis turned through, scaled by how far through the step the display is
+	float angle = atan2(previousX.x * currentX.y - previousX.y * currentX.x, previousX.dot(currentX)) * alpha;
+
+	float cosAngle = cos(angle);
+	float sinAngle = sin(angle);
+
+	//turn both axes by the partial angle and blend their lengths
+	for (int i = 0; i < 2; i++)
+	{
+		Vector2 previousAxis = previousTransform[i];
+		Vector2 currentAxis = globalTransform[i];
+
+		float previousLength = previousAxis.magnitude();
+		float length = previousLength + (currentAxis.magnitude() - previousLength) * alpha;
+
+		Vector2 turned = Vector2{ previousAxis.x * cosAngle - previousAxis.y * sinAngle, previousAxis.x * sinAngle + previousAxis.y * cosAngle };
+
+		if (previousLength > 0.0f)
+		{
+			turned = turned * (length / previousLength);
+		}
+
+		blended[i] = turned;
+	}
+
+	//the translation is blended in a straight line
+	Vector2 previousTranslation = previousTransform[2];
+	blended[2] = previousTranslation + (globalTransform[2] - previousTranslation) * alpha;
+
+	return blended;
+}
+
 //sets the parent of the transform, adds the child to the parent
 void Transform::setParent(Transform * parentPtr)
 {
@@ -96,7 +139,7 @@ void Transform::setParent(Transform * parentPtr)
 	parent = parentPtr;
 	
 	//invert the global matrix from the parent so that this transform doesn't change
-	Matrix3 inv = parent->globalTransform;
+	Affine2 inv = parent->globalTransform;
 	inv.invert();
 
 	inv = inv * globalTransform;
@@ -129,7 +172,7 @@ void Transform::addChild(Transform * child)
 	child->updateGlobalTransform();
 
 	//invert the global matrix from the parent so that this transform doesn't change
-	Matrix3 inv = globalTransform;
+	Affine2 inv = globalTransform;
 	inv.invert();
 
 	inv = inv * child->globalTransform;
@@ -213,12 +256,12 @@ void Transform::removeChild(Transform * child)
 
 
 //extracts individual translation, rotation and scale from one matrix
-Transform extractMatrix(Matrix3 matrix)
+Transform extractMatrix(Affine2 matrix)
 {
 	Transform transform = Transform{};
 
-	//extract the transformed translation from the bottom row, this is not correct yet
-	transform.translation = Vector2{ matrix[2][0], matrix[2][1] };
+	//extract the transformed translation
+	transform.translation = matrix.getTranslation();
 
 	//extract the scale
 	transform.scale = matrix.getScale();
@@ -20,8 +20,13 @@ public:
 	Transform* parent = nullptr; //pointer to the parent
 	std::vector<Transform*> children; //pointers to children
 
-	Matrix3 localTransform = Matrix3{}; //transformation in local space
-	Matrix3 globalTransform = Matrix3{}; //transformation in global space
+	Affine2 localTransform = Affine2{}; //transformation in local space
+	Affine2 globalTransform = Affine2{}; //transformation in global space
+
+	unsigned int version = 0; //stamp that changes every time globalTransform does, lets colliders reuse cached geometry
+
+	Affine2 previousTransform = Affine2{}; //globalTransform before the last fixed step, rendering interpolates from it
+	unsigned int previousStep = 0; //the fixed step previousTransform was stored for, 0 if it never was
 
 	Vector2 translation = Vector2{0,0}; //translation as a vector
 	float rotation = 0.0f; //rotation in radians
@@ -82,6 +87,40 @@ public:
 	*/
 	void updateChildren();
 
+	/*
+	* setGlobalTransform
+	*
+	* assigns a new global transformation, the version stamp
+	* is only changed if the transformation is actually different
+	*
+	* @param const Affine2& newTransform - the recalculated global transformation
+	* @returns void
+	*/
+	void setGlobalTransform(const Affine2& newTransform);
+
+	/*
+	* storePrevious
+	*
+	* remembers the current global transformation before a fixed step moves it
+	*
+	* @param unsigned int step - the fixed step that is about to run
+	* @returns void
+	*/
+	void storePrevious(unsigned int step);
+
+	/*
+	* getRenderTransform
+	*
+	* blends between the transformation stored by storePrevious and the current one.
+	* the rotation is blended as an angle so the shape doesn't shrink while it turns.
+	* transforms that weren't stored for the given step (created during it) aren't blended
+	*
+	* @param unsigned int step - the last fixed step that ran
+	* @param float alpha - how far through the next fixed step the display is, 0 to 1
+	* @returns Affine2 - the transformation to draw with
+	*/
+	Affine2 getRenderTransform(unsigned int step, float alpha);
+
 	/*
 	* setParent
 	* 
@@ -137,9 +176,9 @@ public:
 * extractMatrix()
 *
 * pulls the individual translation, rotation and scale
-* from a full transformation matrix
+* from a full transformation
 *
-* @param Matrix3 matrix - the transformation matrix to extract from
+* @param Affine2 matrix - the transformation to extract from
 * @returns Transform - the transform containing the individual transformations
 */
-Transform extractMatrix(Matrix3 matrix);
\ No newline at end of file
+Transform extractMatrix(Affine2 matrix);
\ No newline at end of file
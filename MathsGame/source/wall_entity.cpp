@@ -34,10 +34,9 @@ void WallEntity::render(Application2D* appPtr)
 {
 	//the rotation occurs from the top-left corner
 	//use another matrix to force entities to rotate from the centre
-	Matrix3 correction = Matrix3{};
-	correction.identity();
+	Affine2 correction = Affine2{};
 	correction[2][0] = wallTexture->getWidth() / -2.0f;
 	correction[2][1] = wallTexture->getHeight() / -2.0f;
 
-	appPtr->m_2dRenderer->drawSpriteTransformed3x3(wallTexture, collider->transform.globalTransform * correction, 0.0f, 0.0f, 0, 0.0f, 0.0f);
+	appPtr->m_2dRenderer->drawSpriteTransformed3x3(wallTexture, Matrix3(appPtr->world.renderTransform(collider->transform) * correction), 0.0f, 0.0f, 0, 0.0f, 0.0f);
 }